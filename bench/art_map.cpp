@@ -0,0 +1,157 @@
+#include <cppds/art_map.hpp>
+#include <cppds/map.hpp>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "common.hpp"
+
+/**
+ * @brief Turn numeric keys into hierarchical, URL-like string keys.
+ */
+static std::vector<std::string> paths(const std::vector<std::uint32_t> &_keys) {
+    std::vector<std::string> result;
+
+    for (std::uint32_t key : _keys) {
+        result.push_back("/tenant/" + std::to_string(key % 64) + "/item/" + std::to_string(key));
+    }
+
+    return result;
+}
+
+template <typename _kTp, typename _vTp>
+static bool contains(const cppds::art_map<_kTp, _vTp> &_map, const _kTp &_key) {
+    return _map.contains(_key);
+}
+
+template <typename _kTp, typename _vTp>
+static bool contains(const cppds::map<_kTp, _vTp> &_map, const _kTp &_key) {
+    return _map.contains(_key);
+}
+
+template <typename _kTp, typename _vTp>
+static bool contains(const std::unordered_map<_kTp, _vTp> &_map, const _kTp &_key) {
+    return _map.count(_key) != 0;
+}
+
+template <typename _Map, typename _Keys>
+static void fill(_Map &_map, const _Keys &_keys) {
+    for (const auto &key : _keys) {
+        _map.insert({key, 1});
+    }
+}
+
+template <typename _kTp, typename _Keys>
+static void fill(cppds::art_map<_kTp, std::uint32_t> &_map, const _Keys &_keys) {
+    for (const auto &key : _keys) {
+        _map.insert(key, 1);
+    }
+}
+
+template <typename _kTp, typename _Keys>
+static void fill(cppds::map<_kTp, std::uint32_t> &_map, const _Keys &_keys) {
+    for (const auto &key : _keys) {
+        _map.insert(key, 1);
+    }
+}
+
+template <typename _Map>
+static void BM_ArtLookupInt(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    _Map m;
+    fill(m, keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : keys) {
+            found += contains(m, key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename _Map>
+static void BM_ArtLookupString(benchmark::State &state) {
+    const auto keys = paths(cppds_bench::keys(state.range(0)));
+
+    _Map m;
+    fill(m, keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const std::string &key : keys) {
+            found += contains(m, key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+static std::size_t count_prefix(const cppds::art_map<std::string, std::uint32_t> &_map, const std::string &_prefix) {
+    std::size_t count = 0;
+    _map.for_each_prefix(_prefix, [&count](const std::string &, std::uint32_t _value) {
+        count += _value;
+    });
+    return count;
+}
+
+static std::size_t count_prefix(const std::map<std::string, std::uint32_t> &_map, const std::string &_prefix) {
+    std::size_t count = 0;
+    for (auto it = _map.lower_bound(_prefix); it != _map.end() && it->first.compare(0, _prefix.size(), _prefix) == 0; ++it) {
+        count += it->second;
+    }
+    return count;
+}
+
+static std::size_t count_prefix(const std::unordered_map<std::string, std::uint32_t> &_map, const std::string &_prefix) {
+    std::size_t count = 0;
+    for (const auto &entry : _map) {
+        if (entry.first.compare(0, _prefix.size(), _prefix) == 0) {
+            count += entry.second;
+        }
+    }
+    return count;
+}
+
+template <typename _Map>
+static void BM_ArtPrefixScan(benchmark::State &state) {
+    const auto keys = paths(cppds_bench::keys(state.range(0)));
+
+    _Map m;
+    fill(m, keys);
+
+    // Each tenant prefix selects 1/64 of the keys.
+    std::vector<std::string> prefixes;
+    for (int tenant = 0; tenant < 64; ++tenant) {
+        prefixes.push_back("/tenant/" + std::to_string(tenant) + "/");
+    }
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (const std::string &prefix : prefixes) {
+            count += count_prefix(m, prefix);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+using art_u32 = cppds::art_map<std::uint32_t, std::uint32_t>;
+using art_string = cppds::art_map<std::string, std::uint32_t>;
+
+BENCHMARK_TEMPLATE(BM_ArtLookupInt, art_u32)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_ArtLookupInt, cppds::map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_ArtLookupInt, std::unordered_map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_ArtLookupString, art_string)->Apply(cppds_bench::sizes_upto<1 << 20>);
+BENCHMARK_TEMPLATE(BM_ArtLookupString, std::unordered_map<std::string, std::uint32_t>)->Apply(cppds_bench::sizes_upto<1 << 20>);
+
+BENCHMARK_TEMPLATE(BM_ArtPrefixScan, art_string)->Apply(cppds_bench::sizes_upto<1 << 20>);
+BENCHMARK_TEMPLATE(BM_ArtPrefixScan, std::map<std::string, std::uint32_t>)->Apply(cppds_bench::sizes_upto<1 << 20>);
+BENCHMARK_TEMPLATE(BM_ArtPrefixScan, std::unordered_map<std::string, std::uint32_t>)->Apply(cppds_bench::sizes_upto<1 << 20>);
@@ -0,0 +1,103 @@
+#include <cppds/btree_map.hpp>
+
+#include <map>
+
+#include "common.hpp"
+
+// The number of consecutive entries read by each range scan.
+static constexpr std::size_t scan_length = 64;
+
+template <typename _Map>
+static void fill(_Map &_map, const std::vector<std::uint32_t> &_keys) {
+    for (std::uint32_t key : _keys) {
+        _map.insert({key, key});
+    }
+}
+
+static void fill(cppds::btree_map<std::uint32_t, std::uint32_t> &_map, const std::vector<std::uint32_t> &_keys) {
+    for (std::uint32_t key : _keys) {
+        _map.insert(key, key);
+    }
+}
+
+template <typename _Map>
+static std::uint64_t scan(const _Map &_map, std::uint32_t _low) {
+    std::uint64_t sum = 0;
+    auto it = _map.lower_bound(_low);
+    for (std::size_t i = 0; i < scan_length && it != _map.end(); ++i, ++it) {
+        sum += it->second;
+    }
+    return sum;
+}
+
+static std::uint64_t scan(const cppds::btree_map<std::uint32_t, std::uint32_t> &_map, std::uint32_t _low) {
+    std::uint64_t sum = 0;
+    _map.for_each(_low, _low + std::uint32_t(scan_length), [&sum](std::uint32_t, std::uint32_t _value) {
+        sum += _value;
+    });
+    return sum;
+}
+
+template <typename _Map>
+static void BM_OrderedMapInsert(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        _Map m;
+        fill(m, keys);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename _Map>
+static void BM_OrderedMapLookup(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    _Map m;
+    fill(m, keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : keys) {
+            found += m.find(key) != m.end();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename _Map>
+static void BM_OrderedMapRangeScan(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    _Map m;
+    fill(m, keys);
+
+    // Scans start at the first keys of the shuffled order, i.e. anywhere.
+    const std::size_t scans = std::min<std::size_t>(keys.size(), 1024);
+
+    cppds_bench::perf_scope scope(state, scans * scan_length);
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < scans; ++i) {
+            sum += scan(m, keys[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+using btree_map_u32 = cppds::btree_map<std::uint32_t, std::uint32_t>;
+using std_map_u32 = std::map<std::uint32_t, std::uint32_t>;
+
+BENCHMARK_TEMPLATE(BM_OrderedMapInsert, btree_map_u32)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_OrderedMapInsert, std_map_u32)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_OrderedMapLookup, btree_map_u32)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_OrderedMapLookup, std_map_u32)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_OrderedMapRangeScan, btree_map_u32)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_OrderedMapRangeScan, std_map_u32)->Apply(cppds_bench::sizes);
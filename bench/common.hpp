@@ -0,0 +1,140 @@
+/**
+ * @file common.hpp
+ * @brief Shared helpers for the cppds benchmarks.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cppds/perf_counters.hpp>
+
+#ifndef CPPDS_BENCH_MAX_SIZE
+#define CPPDS_BENCH_MAX_SIZE 100000000
+#endif
+
+namespace cppds_bench {
+
+    /**
+     * @brief Apply the standard size sweep, 16 to CPPDS_BENCH_MAX_SIZE elements.
+     */
+    inline void sizes(benchmark::internal::Benchmark *_bench) {
+        _bench->RangeMultiplier(16)->Range(16, CPPDS_BENCH_MAX_SIZE);
+    }
+
+    /**
+     * @brief Apply a size sweep capped below CPPDS_BENCH_MAX_SIZE, for
+     * operations whose cost grows faster than linearly with the size.
+     */
+    template <std::int64_t _Max>
+    void sizes_upto(benchmark::internal::Benchmark *_bench) {
+        _bench->RangeMultiplier(16)->Range(16, _Max < CPPDS_BENCH_MAX_SIZE ? _Max : CPPDS_BENCH_MAX_SIZE);
+    }
+
+    /**
+     * @brief Generate distinct keys in a random order.
+     *
+     * The keys are a shuffled permutation of [_offset, _offset + _count), so
+     * keys from two calls with disjoint ranges never collide; use that to
+     * produce lookups that miss.
+     *
+     * @param _count The number of keys.
+     * @param _offset The smallest key.
+     * @return The shuffled keys.
+     */
+    inline std::vector<std::uint32_t> keys(std::size_t _count, std::uint32_t _offset = 0) {
+        std::vector<std::uint32_t> keys(_count);
+
+        for (std::size_t i = 0; i < _count; ++i) {
+            keys[i] = _offset + std::uint32_t(i);
+        }
+
+        std::mt19937_64 rng(_count ^ _offset);
+        std::shuffle(keys.begin(), keys.end(), rng);
+
+        return keys;
+    }
+
+    /**
+     * @brief Measures a benchmark loop and reports per-operation results.
+     *
+     * Construct it right before `for (auto _ : state)`. On destruction it
+     * reports throughput in operations per second and, where hardware
+     * counters are available, each counter divided by the number of
+     * operations. Use pause()/resume() instead of State::PauseTiming and
+     * State::ResumeTiming so untimed setup is not counted either.
+     *
+     * The counters cover the constructing thread and the threads it creates
+     * afterwards, so construct a thread pool after the scope. In a benchmark
+     * run on several threads each thread measures itself, and the counters
+     * are averaged across the threads.
+     */
+    class perf_scope {
+    public:
+        /**
+         * @brief Start measuring.
+         *
+         * @param _state The benchmark state.
+         * @param _per_iteration The number of operations per loop iteration.
+         */
+        perf_scope(benchmark::State &_state, std::size_t _per_iteration) :
+            _M_state(_state), _M_per_iteration(_per_iteration) {
+            _M_counters.start();
+        }
+
+        perf_scope(const perf_scope &) = delete;
+        perf_scope &operator=(const perf_scope &) = delete;
+
+        /**
+         * @brief Stop measuring and report the results.
+         */
+        ~perf_scope() {
+            _M_counters.stop();
+
+            double operations = double(_M_state.iterations()) * double(_M_per_iteration);
+
+            _M_state.SetItemsProcessed(std::int64_t(operations));
+
+            if (operations == 0) {
+                return;
+            }
+
+            for (std::size_t i = 0; i < cppds::perf_counters::event_count; ++i) {
+                auto event = cppds::perf_counters::event(i);
+
+                if (_M_counters.available(event)) {
+                    _M_state.counters[cppds::perf_counters::name(event)] = benchmark::Counter(
+                        double(_M_counters.value(event)) / operations, benchmark::Counter::kAvgThreads);
+                }
+            }
+        }
+
+        /**
+         * @brief Pause timing and counting.
+         */
+        void pause() {
+            _M_counters.stop();
+            _M_state.PauseTiming();
+        }
+
+        /**
+         * @brief Resume timing and counting.
+         */
+        void resume() {
+            _M_state.ResumeTiming();
+            _M_counters.start();
+        }
+
+    protected:
+        benchmark::State &_M_state;             ///< The benchmark state.
+        std::size_t _M_per_iteration;           ///< The number of operations per iteration.
+        cppds::perf_counters _M_counters;       ///< The hardware counters.
+    };
+
+} // namespace cppds_bench
@@ -0,0 +1,128 @@
+#include <cppds/concurrent_skiplist_map.hpp>
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "common.hpp"
+
+// The number of insertions, or entries scanned, per iteration and thread.
+static constexpr std::size_t batch = 1024;
+
+/**
+ * @brief std::map behind a reader-writer lock, for comparison.
+ */
+class locked_map {
+public:
+    bool insert(std::uint64_t _key, std::uint64_t _value) {
+        std::unique_lock<std::shared_mutex> lock(_M_mutex);
+        return _M_map.emplace(_key, _value).second;
+    }
+
+    std::uint64_t scan(std::uint64_t _low, std::size_t _count) const {
+        std::shared_lock<std::shared_mutex> lock(_M_mutex);
+        std::uint64_t sum = 0;
+        auto it = _M_map.lower_bound(_low);
+        for (std::size_t i = 0; i < _count && it != _M_map.end(); ++i, ++it) {
+            sum += it->second;
+        }
+        return sum;
+    }
+
+protected:
+    mutable std::shared_mutex _M_mutex;
+    std::map<std::uint64_t, std::uint64_t> _M_map;
+};
+
+using skiplist = cppds::concurrent_skiplist_map<std::uint64_t, std::uint64_t>;
+
+static std::uint64_t scan(const skiplist &_map, std::uint64_t _low, std::size_t _count) {
+    std::uint64_t sum = 0;
+    auto it = _map.lower_bound(_low);
+    for (std::size_t i = 0; i < _count && it != _map.end(); ++i, ++it) {
+        sum += it.value();
+    }
+    return sum;
+}
+
+static std::uint64_t scan(const locked_map &_map, std::uint64_t _low, std::size_t _count) {
+    return _map.scan(_low, _count);
+}
+
+/**
+ * @brief A per-thread stream of well-spread keys.
+ */
+static std::uint64_t next_key(std::uint64_t &_state) {
+    _state += 0x9e3779b97f4a7c15ull;
+    std::uint64_t z = _state;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+template <typename _Map>
+static _Map *shared_map;
+
+template <typename _Map>
+static void BM_ConcurrentInsert(benchmark::State &state) {
+    if (state.thread_index() == 0) {
+        shared_map<_Map> = new _Map();
+    }
+
+    std::uint64_t rng = std::uint64_t(state.thread_index()) << 32;
+
+    cppds_bench::perf_scope scope(state, batch);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < batch; ++i) {
+            std::uint64_t key = next_key(rng);
+            shared_map<_Map>->insert(key, key);
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        delete shared_map<_Map>;
+    }
+}
+
+/**
+ * @brief Thread 0 scans ranges while the other threads insert.
+ */
+template <typename _Map>
+static void BM_ConcurrentInsertAndScan(benchmark::State &state) {
+    if (state.thread_index() == 0) {
+        shared_map<_Map> = new _Map();
+
+        std::uint64_t rng = ~std::uint64_t(0);
+        for (std::size_t i = 0; i < 65536; ++i) {
+            std::uint64_t key = next_key(rng);
+            shared_map<_Map>->insert(key, key);
+        }
+    }
+
+    std::uint64_t rng = std::uint64_t(state.thread_index()) << 32;
+    bool scanner = state.thread_index() == 0;
+
+    cppds_bench::perf_scope scope(state, batch);
+
+    for (auto _ : state) {
+        if (scanner) {
+            benchmark::DoNotOptimize(scan(*shared_map<_Map>, next_key(rng), batch));
+        } else {
+            for (std::size_t i = 0; i < batch; ++i) {
+                std::uint64_t key = next_key(rng);
+                shared_map<_Map>->insert(key, key);
+            }
+        }
+    }
+
+    if (state.thread_index() == 0) {
+        delete shared_map<_Map>;
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_ConcurrentInsert, skiplist)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentInsert, locked_map)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_ConcurrentInsertAndScan, skiplist)->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentInsertAndScan, locked_map)->ThreadRange(2, 8)->UseRealTime();
@@ -0,0 +1,122 @@
+#include <cppds/flat_map.hpp>
+
+#include <map>
+
+#include "common.hpp"
+
+static cppds::flat_map<std::uint32_t, std::uint32_t> build_flat(const std::vector<std::uint32_t> &_keys) {
+    std::vector<cppds::pair<std::uint32_t, std::uint32_t>> pairs;
+
+    for (std::uint32_t key : _keys) {
+        pairs.emplace_back(key, key);
+    }
+
+    return cppds::flat_map<std::uint32_t, std::uint32_t>(pairs.begin(), pairs.end());
+}
+
+static void BM_FlatMapBuild(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    std::vector<cppds::pair<std::uint32_t, std::uint32_t>> pairs;
+    for (std::uint32_t key : keys) {
+        pairs.emplace_back(key, key);
+    }
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        cppds::flat_map<std::uint32_t, std::uint32_t> m(pairs.begin(), pairs.end());
+        benchmark::DoNotOptimize(m.size());
+    }
+}
+
+static void BM_FlatMapLookupHit(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+    const auto m = build_flat(keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : keys) {
+            found += m.contains(key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+static void BM_FlatMapIterate(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+    const auto m = build_flat(keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < m.size(); ++i) {
+            sum += m.values()[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_StdMapBuild(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::map<std::uint32_t, std::uint32_t> m;
+        for (std::uint32_t key : keys) {
+            m.emplace(key, key);
+        }
+        benchmark::DoNotOptimize(m.size());
+    }
+}
+
+static void BM_StdMapLookupHit(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    std::map<std::uint32_t, std::uint32_t> m;
+    for (std::uint32_t key : keys) {
+        m.emplace(key, key);
+    }
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : keys) {
+            found += m.count(key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+static void BM_StdMapIterate(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    std::map<std::uint32_t, std::uint32_t> m;
+    for (std::uint32_t key : keys) {
+        m.emplace(key, key);
+    }
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const auto &entry : m) {
+            sum += entry.second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_FlatMapBuild)->Apply(cppds_bench::sizes);
+BENCHMARK(BM_StdMapBuild)->Apply(cppds_bench::sizes);
+
+BENCHMARK(BM_FlatMapLookupHit)->Apply(cppds_bench::sizes);
+BENCHMARK(BM_StdMapLookupHit)->Apply(cppds_bench::sizes);
+
+BENCHMARK(BM_FlatMapIterate)->Apply(cppds_bench::sizes);
+BENCHMARK(BM_StdMapIterate)->Apply(cppds_bench::sizes);
@@ -0,0 +1,112 @@
+#include <cppds/indexed_priority_queue.hpp>
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "common.hpp"
+
+namespace {
+
+    // A random directed graph with eight out-edges per vertex in CSR form.
+    struct graph {
+        std::vector<std::uint32_t> offsets;
+        std::vector<std::uint32_t> targets;
+        std::vector<std::uint32_t> weights;
+
+        explicit graph(std::size_t _vertices) {
+            std::mt19937_64 rng(_vertices);
+
+            offsets.resize(_vertices + 1);
+            for (std::size_t v = 0; v < _vertices; ++v) {
+                offsets[v] = std::uint32_t(targets.size());
+                for (int e = 0; e < 8; ++e) {
+                    targets.push_back(std::uint32_t(rng() % _vertices));
+                    weights.push_back(std::uint32_t(rng() % 1000 + 1));
+                }
+            }
+            offsets[_vertices] = std::uint32_t(targets.size());
+        }
+    };
+
+    constexpr std::uint64_t infinity = std::numeric_limits<std::uint64_t>::max();
+}
+
+static void BM_IndexedPriorityQueueDijkstra(benchmark::State &state) {
+    const graph g(state.range(0));
+    std::vector<std::uint64_t> dist;
+
+    cppds_bench::perf_scope scope(state, g.targets.size());
+
+    for (auto _ : state) {
+        dist.assign(state.range(0), infinity);
+        cppds::indexed_priority_queue<std::uint64_t> q(state.range(0));
+        std::size_t max_size = 0;
+
+        dist[0] = 0;
+        q.push(0, 0);
+
+        while (!q.empty()) {
+            std::size_t u = q.top_handle();
+            q.pop();
+
+            for (std::uint32_t e = g.offsets[u]; e < g.offsets[u + 1]; ++e) {
+                std::uint64_t d = dist[u] + g.weights[e];
+                if (d < dist[g.targets[e]]) {
+                    dist[g.targets[e]] = d;
+                    q.update(g.targets[e], d);
+                }
+            }
+
+            max_size = std::max(max_size, q.size());
+        }
+
+        benchmark::DoNotOptimize(dist.data());
+        state.counters["max_heap_size"] = double(max_size);
+    }
+}
+
+static void BM_StdPriorityQueueLazyDijkstra(benchmark::State &state) {
+    const graph g(state.range(0));
+    std::vector<std::uint64_t> dist;
+
+    using item = std::pair<std::uint64_t, std::uint32_t>;
+
+    cppds_bench::perf_scope scope(state, g.targets.size());
+
+    for (auto _ : state) {
+        dist.assign(state.range(0), infinity);
+        std::priority_queue<item, std::vector<item>, std::greater<item>> q;
+        std::size_t max_size = 0;
+
+        dist[0] = 0;
+        q.emplace(0, 0);
+
+        while (!q.empty()) {
+            item top = q.top();
+            q.pop();
+
+            // Stale duplicates stand in for decrease-key.
+            if (top.first != dist[top.second]) {
+                continue;
+            }
+
+            for (std::uint32_t e = g.offsets[top.second]; e < g.offsets[top.second + 1]; ++e) {
+                std::uint64_t d = top.first + g.weights[e];
+                if (d < dist[g.targets[e]]) {
+                    dist[g.targets[e]] = d;
+                    q.emplace(d, g.targets[e]);
+                }
+            }
+
+            max_size = std::max(max_size, q.size());
+        }
+
+        benchmark::DoNotOptimize(dist.data());
+        state.counters["max_heap_size"] = double(max_size);
+    }
+}
+
+BENCHMARK(BM_IndexedPriorityQueueDijkstra)->Apply(cppds_bench::sizes_upto<1 << 24>);
+BENCHMARK(BM_StdPriorityQueueLazyDijkstra)->Apply(cppds_bench::sizes_upto<1 << 24>);
@@ -0,0 +1,113 @@
+#include <cppds/map.hpp>
+
+#include <unordered_map>
+
+#include "common.hpp"
+
+template <typename _kTp, typename _vTp>
+static bool contains(const cppds::map<_kTp, _vTp> &_map, const _kTp &_key) {
+    return _map.contains(_key);
+}
+
+template <typename _kTp, typename _vTp>
+static bool contains(const std::unordered_map<_kTp, _vTp> &_map, const _kTp &_key) {
+    return _map.count(_key) != 0;
+}
+
+template <typename _kTp, typename _vTp>
+static void insert(cppds::map<_kTp, _vTp> &_map, const _kTp &_key, const _vTp &_value) {
+    _map.insert(_key, _value);
+}
+
+template <typename _kTp, typename _vTp>
+static void insert(std::unordered_map<_kTp, _vTp> &_map, const _kTp &_key, const _vTp &_value) {
+    _map.insert_or_assign(_key, _value);
+}
+
+template <typename _Map>
+static void fill(_Map &_map, const std::vector<std::uint32_t> &_keys) {
+    for (std::uint32_t key : _keys) {
+        insert(_map, key, key);
+    }
+}
+
+template <typename _Map>
+static void BM_MapInsert(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        _Map s;
+        fill(s, keys);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename _Map>
+static void BM_MapLookupHit(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    _Map s;
+    fill(s, keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : keys) {
+            found += contains(s, key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename _Map>
+static void BM_MapLookupMiss(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+    const auto misses = cppds_bench::keys(state.range(0), std::uint32_t(state.range(0)));
+
+    _Map s;
+    fill(s, keys);
+
+    cppds_bench::perf_scope scope(state, misses.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : misses) {
+            found += contains(s, key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename _Map>
+static void BM_MapErase(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        scope.pause();
+        _Map s;
+        fill(s, keys);
+        scope.resume();
+
+        for (std::uint32_t key : keys) {
+            s.erase(key);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_MapInsert, cppds::map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapInsert, std::unordered_map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_MapLookupHit, cppds::map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapLookupHit, std::unordered_map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_MapLookupMiss, cppds::map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapLookupMiss, std::unordered_map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_MapErase, cppds::map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_MapErase, std::unordered_map<std::uint32_t, std::uint32_t>)->Apply(cppds_bench::sizes);
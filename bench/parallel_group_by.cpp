@@ -0,0 +1,89 @@
+#include <cppds/parallel_group_by.hpp>
+
+#include <mutex>
+
+#include "common.hpp"
+
+// Summing one large table of (key, amount) rows per key: a sequential map,
+// parallel_group_by and one mutex-protected map shared by all workers, on
+// pools of 1 to 16 workers.
+static constexpr std::int64_t rows_size =
+    CPPDS_BENCH_MAX_SIZE < (std::int64_t(1) << 24) ? CPPDS_BENCH_MAX_SIZE : std::int64_t(1) << 24;
+
+using row = cppds::pair<std::uint32_t, std::uint64_t>;
+
+static cppds::vector<row> make_rows(std::uint32_t _groups) {
+    cppds::vector<row> rows;
+    rows.reserve(rows_size);
+
+    const auto keys = cppds_bench::keys(rows_size);
+    for (std::uint32_t key : keys) {
+        rows.push_back(row(key % _groups, key));
+    }
+
+    return rows;
+}
+
+static void add(cppds::map<std::uint32_t, std::uint64_t> &_sums, const row &_row) {
+    std::uint64_t *sum = _sums.find(_row.first);
+
+    if (sum) {
+        *sum += _row.second;
+    }
+    else {
+        _sums.insert(_row.first, _row.second);
+    }
+}
+
+static void BM_GroupBySequential(benchmark::State &state) {
+    const auto rows = make_rows(std::uint32_t(state.range(0)));
+
+    cppds_bench::perf_scope scope(state, rows.size());
+
+    for (auto _ : state) {
+        cppds::map<std::uint32_t, std::uint64_t> sums;
+        for (const row &r : rows) {
+            add(sums, r);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_GroupByParallel(benchmark::State &state) {
+    const auto rows = make_rows(std::uint32_t(state.range(0)));
+    cppds_bench::perf_scope scope(state, rows.size());
+
+    // Created after the counters so that its workers are counted.
+    cppds::thread_pool pool(state.range(1));
+
+    for (auto _ : state) {
+        cppds::map<std::uint32_t, std::uint64_t> sums;
+        cppds::parallel_group_by(rows.begin(), rows.end(), sums,
+            [](const row &_row) { return _row; },
+            [](std::uint64_t _a, std::uint64_t _b) { return _a + _b; }, pool);
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_GroupBySharedMap(benchmark::State &state) {
+    const auto rows = make_rows(std::uint32_t(state.range(0)));
+    cppds_bench::perf_scope scope(state, rows.size());
+
+    // Created after the counters so that its workers are counted.
+    cppds::thread_pool pool(state.range(1));
+
+    for (auto _ : state) {
+        cppds::map<std::uint32_t, std::uint64_t> sums;
+        std::mutex mutex;
+        pool.parallel_for(0, rows.size(), 4096, [&](std::size_t i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            add(sums, rows[i]);
+        });
+        benchmark::ClobberMemory();
+    }
+}
+
+// Few groups, where pre-aggregation shrinks the data, and many.
+BENCHMARK(BM_GroupBySequential)->Arg(1 << 10)->Arg(1 << 20)->UseRealTime();
+BENCHMARK(BM_GroupByParallel)->ArgsProduct({{1 << 10, 1 << 20}, {1, 2, 4, 8, 16}})->UseRealTime();
+BENCHMARK(BM_GroupBySharedMap)->ArgsProduct({{1 << 10, 1 << 20}, {1, 4, 16}})->UseRealTime();
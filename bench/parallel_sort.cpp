@@ -0,0 +1,96 @@
+#include <cppds/parallel_sort.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include "common.hpp"
+
+// Sorting one large vector of random 64-bit keys sequentially and on pools
+// of 1 to 16 workers; the time per element should fall with the worker count.
+static constexpr std::int64_t sort_size =
+    CPPDS_BENCH_MAX_SIZE < (std::int64_t(1) << 26) ? CPPDS_BENCH_MAX_SIZE : std::int64_t(1) << 26;
+
+static cppds::vector<std::uint64_t> make_input() {
+    cppds::vector<std::uint64_t> values;
+    values.resize(sort_size, cppds::default_init);
+
+    std::mt19937_64 rng(sort_size);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = rng();
+    }
+
+    return values;
+}
+
+static void BM_SequentialSort(benchmark::State &state) {
+    const auto input = make_input();
+    cppds::vector<std::uint64_t> values;
+
+    cppds_bench::perf_scope scope(state, input.size());
+
+    for (auto _ : state) {
+        scope.pause();
+        values = input;
+        scope.resume();
+
+        cppds::sort(values.begin(), values.end());
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_ParallelSort(benchmark::State &state) {
+    const auto input = make_input();
+    cppds::vector<std::uint64_t> values;
+    cppds_bench::perf_scope scope(state, input.size());
+
+    // Created after the counters so that its workers are counted.
+    cppds::thread_pool pool(state.range(0));
+
+    for (auto _ : state) {
+        scope.pause();
+        values = input;
+        scope.resume();
+
+        cppds::parallel_sort(values.begin(), values.end(), std::less<std::uint64_t>(), pool);
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_SequentialStableSort(benchmark::State &state) {
+    const auto input = make_input();
+    cppds::vector<std::uint64_t> values;
+
+    cppds_bench::perf_scope scope(state, input.size());
+
+    for (auto _ : state) {
+        scope.pause();
+        values = input;
+        scope.resume();
+
+        std::stable_sort(values.begin(), values.end());
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_ParallelStableSort(benchmark::State &state) {
+    const auto input = make_input();
+    cppds::vector<std::uint64_t> values;
+    cppds_bench::perf_scope scope(state, input.size());
+
+    // Created after the counters so that its workers are counted.
+    cppds::thread_pool pool(state.range(0));
+
+    for (auto _ : state) {
+        scope.pause();
+        values = input;
+        scope.resume();
+
+        cppds::parallel_stable_sort(values.begin(), values.end(), std::less<std::uint64_t>(), pool);
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_SequentialSort)->UseRealTime();
+BENCHMARK(BM_ParallelSort)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_SequentialStableSort)->UseRealTime();
+BENCHMARK(BM_ParallelStableSort)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
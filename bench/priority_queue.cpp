@@ -0,0 +1,123 @@
+#include <cppds/priority_queue.hpp>
+
+#include <queue>
+
+#include "common.hpp"
+
+// Heap operations are O(log n), so the sweep stops at 16M elements.
+static constexpr std::int64_t max_heap_size = 1 << 24;
+
+static void BM_PriorityQueuePushPop(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        cppds::priority_queue<std::uint32_t> q;
+        for (std::uint32_t key : keys) {
+            q.push(key);
+        }
+
+        std::uint64_t sum = 0;
+        while (!q.empty()) {
+            sum += q.top();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_PriorityQueueHeapifyDrain(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        cppds::priority_queue<std::uint32_t> q(keys.begin(), keys.end());
+
+        std::uint64_t sum = 0;
+        while (!q.empty()) {
+            sum += q.top();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_PriorityQueueReplaceTop(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+    cppds::priority_queue<std::uint32_t> q(keys.begin(), keys.end());
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::uint32_t key : keys) {
+            sum += q.replace_top(key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_StdPriorityQueuePushPop(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::priority_queue<std::uint32_t> q;
+        for (std::uint32_t key : keys) {
+            q.push(key);
+        }
+
+        std::uint64_t sum = 0;
+        while (!q.empty()) {
+            sum += q.top();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_StdPriorityQueueHeapifyDrain(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::priority_queue<std::uint32_t> q(keys.begin(), keys.end());
+
+        std::uint64_t sum = 0;
+        while (!q.empty()) {
+            sum += q.top();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_StdPriorityQueueReplaceTop(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+    std::priority_queue<std::uint32_t> q(keys.begin(), keys.end());
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::uint32_t key : keys) {
+            sum += q.top();
+            q.pop();
+            q.push(key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_PriorityQueuePushPop)->Apply(cppds_bench::sizes_upto<max_heap_size>);
+BENCHMARK(BM_StdPriorityQueuePushPop)->Apply(cppds_bench::sizes_upto<max_heap_size>);
+
+BENCHMARK(BM_PriorityQueueHeapifyDrain)->Apply(cppds_bench::sizes_upto<max_heap_size>);
+BENCHMARK(BM_StdPriorityQueueHeapifyDrain)->Apply(cppds_bench::sizes_upto<max_heap_size>);
+
+BENCHMARK(BM_PriorityQueueReplaceTop)->Apply(cppds_bench::sizes_upto<max_heap_size>);
+BENCHMARK(BM_StdPriorityQueueReplaceTop)->Apply(cppds_bench::sizes_upto<max_heap_size>);
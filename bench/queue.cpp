@@ -0,0 +1,49 @@
+#include <cppds/queue.hpp>
+
+#include <deque>
+#include <queue>
+
+#include "common.hpp"
+
+template <typename _Queue>
+static void BM_QueuePush(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        _Queue q;
+        for (std::size_t i = 0; i < n; ++i) {
+            q.push(std::uint32_t(i));
+        }
+        benchmark::DoNotOptimize(q.back());
+    }
+}
+
+template <typename _Queue>
+static void BM_QueuePushPop(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        _Queue q;
+        for (std::size_t i = 0; i < n; ++i) {
+            q.push(std::uint32_t(i));
+        }
+        std::uint64_t sum = 0;
+        while (!q.empty()) {
+            sum += q.front();
+            q.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_QueuePush, cppds::queue<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_QueuePush, std::queue<std::uint32_t, std::deque<std::uint32_t>>)->Apply(cppds_bench::sizes);
+
+// cppds::queue pops from the front of a vector, which is O(n) per pop, so
+// draining is quadratic and the sweep is capped.
+BENCHMARK_TEMPLATE(BM_QueuePushPop, cppds::queue<std::uint32_t>)->Apply(cppds_bench::sizes_upto<65536>);
+BENCHMARK_TEMPLATE(BM_QueuePushPop, std::queue<std::uint32_t, std::deque<std::uint32_t>>)->Apply(cppds_bench::sizes);
@@ -0,0 +1,95 @@
+#include <cppds/priority_queue.hpp>
+#include <cppds/radix_heap.hpp>
+
+#include <queue>
+
+#include "common.hpp"
+
+namespace {
+
+    struct event {
+        std::uint64_t time;
+        std::uint32_t id;
+    };
+
+    struct later {
+        bool operator()(const event &_a, const event &_b) const {
+            return _a.time > _b.time;
+        }
+    };
+
+    // Delays of rescheduled events, up to the number of pending events.
+    std::vector<std::uint32_t> delays(std::size_t _count) {
+        std::vector<std::uint32_t> delays = cppds_bench::keys(_count);
+
+        for (std::uint32_t &delay : delays) {
+            delay += 1;
+        }
+
+        return delays;
+    }
+}
+
+// A discrete-event simulation in steady state: state.range(0) events are
+// pending, and each processed event schedules one more in the future.
+
+static void BM_RadixHeapEvents(benchmark::State &state) {
+    const auto delay = delays(state.range(0));
+
+    cppds::radix_heap<std::uint64_t, std::uint32_t> h;
+    for (std::uint32_t i = 0; i < delay.size(); ++i) {
+        h.push(delay[i], i);
+    }
+
+    cppds_bench::perf_scope scope(state, delay.size());
+
+    for (auto _ : state) {
+        for (std::uint32_t d : delay) {
+            std::uint64_t now = h.top();
+            std::uint32_t id = h.top_value();
+            h.pop();
+            h.push(now + d, id);
+        }
+    }
+}
+
+static void BM_PriorityQueueEvents(benchmark::State &state) {
+    const auto delay = delays(state.range(0));
+
+    cppds::priority_queue<event, later> q;
+    for (std::uint32_t i = 0; i < delay.size(); ++i) {
+        q.push(event {delay[i], i});
+    }
+
+    cppds_bench::perf_scope scope(state, delay.size());
+
+    for (auto _ : state) {
+        for (std::uint32_t d : delay) {
+            event next = q.top();
+            q.replace_top(event {next.time + d, next.id});
+        }
+    }
+}
+
+static void BM_StdPriorityQueueEvents(benchmark::State &state) {
+    const auto delay = delays(state.range(0));
+
+    std::priority_queue<event, std::vector<event>, later> q;
+    for (std::uint32_t i = 0; i < delay.size(); ++i) {
+        q.push(event {delay[i], i});
+    }
+
+    cppds_bench::perf_scope scope(state, delay.size());
+
+    for (auto _ : state) {
+        for (std::uint32_t d : delay) {
+            event next = q.top();
+            q.pop();
+            q.push(event {next.time + d, next.id});
+        }
+    }
+}
+
+BENCHMARK(BM_RadixHeapEvents)->Apply(cppds_bench::sizes_upto<1 << 24>);
+BENCHMARK(BM_PriorityQueueEvents)->Apply(cppds_bench::sizes_upto<1 << 24>);
+BENCHMARK(BM_StdPriorityQueueEvents)->Apply(cppds_bench::sizes_upto<1 << 24>);
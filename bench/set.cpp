@@ -0,0 +1,137 @@
+#include <cppds/parallel_hash_build.hpp>
+#include <cppds/set.hpp>
+
+#include <unordered_set>
+
+#include "common.hpp"
+
+template <typename _Tp>
+static bool contains(const cppds::set<_Tp> &_set, const _Tp &_key) {
+    return _set.contains(_key);
+}
+
+template <typename _Tp>
+static bool contains(const std::unordered_set<_Tp> &_set, const _Tp &_key) {
+    return _set.count(_key) != 0;
+}
+
+template <typename _Set>
+static void fill(_Set &_set, const std::vector<std::uint32_t> &_keys) {
+    for (std::uint32_t key : _keys) {
+        _set.insert(key);
+    }
+}
+
+template <typename _Set>
+static void BM_SetInsert(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        _Set s;
+        fill(s, keys);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename _Set>
+static void BM_SetLookupHit(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    _Set s;
+    fill(s, keys);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : keys) {
+            found += contains(s, key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename _Set>
+static void BM_SetLookupMiss(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+    const auto misses = cppds_bench::keys(state.range(0), std::uint32_t(state.range(0)));
+
+    _Set s;
+    fill(s, keys);
+
+    cppds_bench::perf_scope scope(state, misses.size());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::uint32_t key : misses) {
+            found += contains(s, key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename _Set>
+static void BM_SetErase(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        scope.pause();
+        _Set s;
+        fill(s, keys);
+        scope.resume();
+
+        for (std::uint32_t key : keys) {
+            s.erase(key);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// Building one large set from a range, sequentially and on pools of 1 to 16
+// workers; the time per element should fall with the worker count.
+static constexpr std::int64_t build_size =
+    CPPDS_BENCH_MAX_SIZE < (std::int64_t(1) << 24) ? CPPDS_BENCH_MAX_SIZE : std::int64_t(1) << 24;
+
+static void BM_SetBuildSequential(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(build_size);
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        cppds::set<std::uint32_t> s;
+        fill(s, keys);
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_SetBuildParallel(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(build_size);
+    cppds::thread_pool pool(state.range(0));
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        cppds::set<std::uint32_t> s;
+        cppds::build_parallel(s, keys.begin(), keys.end(), pool);
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_SetInsert, cppds::set<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetInsert, std::unordered_set<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_SetLookupHit, cppds::set<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetLookupHit, std::unordered_set<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_SetLookupMiss, cppds::set<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetLookupMiss, std::unordered_set<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_SetErase, cppds::set<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_SetErase, std::unordered_set<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK(BM_SetBuildSequential)->UseRealTime();
+BENCHMARK(BM_SetBuildParallel)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
@@ -0,0 +1,110 @@
+#include <cppds/sort.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include "common.hpp"
+
+// Sorting random data of the widths that matter in practice, with std::sort,
+// cppds::sort and cppds::radix_sort.
+struct record {
+    std::uint64_t key;
+    std::uint64_t payload;
+};
+
+template <typename _Tp>
+static cppds::vector<_Tp> make_input(std::size_t _count) {
+    cppds::vector<_Tp> values;
+    values.resize(_count, cppds::default_init);
+
+    std::mt19937_64 rng(_count);
+
+    for (std::size_t i = 0; i < _count; ++i) {
+        std::uint64_t bits = rng();
+
+        if constexpr (std::is_same<_Tp, record>::value) {
+            values[i] = record {bits, i};
+        }
+        else if constexpr (std::is_floating_point<_Tp>::value) {
+            values[i] = _Tp(std::int64_t(bits)) / _Tp(1 << 20);
+        }
+        else {
+            values[i] = _Tp(bits);
+        }
+    }
+
+    return values;
+}
+
+struct std_sorter {
+    template <typename _Tp>
+    void operator()(cppds::vector<_Tp> &_values) const {
+        if constexpr (std::is_same<_Tp, record>::value) {
+            std::sort(_values.begin(), _values.end(), [](const record &_a, const record &_b) {
+                return _a.key < _b.key;
+            });
+        }
+        else {
+            std::sort(_values.begin(), _values.end());
+        }
+    }
+};
+
+struct pdq_sorter {
+    template <typename _Tp>
+    void operator()(cppds::vector<_Tp> &_values) const {
+        if constexpr (std::is_same<_Tp, record>::value) {
+            cppds::sort(_values.begin(), _values.end(), [](const record &_a, const record &_b) {
+                return _a.key < _b.key;
+            });
+        }
+        else {
+            cppds::sort(_values.begin(), _values.end());
+        }
+    }
+};
+
+struct radix_sorter {
+    template <typename _Tp>
+    void operator()(cppds::vector<_Tp> &_values) const {
+        if constexpr (std::is_same<_Tp, record>::value) {
+            cppds::radix_sort(_values.begin(), _values.end(), [](const record &_r) { return _r.key; });
+        }
+        else {
+            cppds::radix_sort(_values.begin(), _values.end());
+        }
+    }
+};
+
+template <typename _Tp, typename _Sorter>
+static void BM_Sort(benchmark::State &state) {
+    const auto input = make_input<_Tp>(state.range(0));
+    cppds::vector<_Tp> values;
+
+    cppds_bench::perf_scope scope(state, input.size());
+
+    for (auto _ : state) {
+        scope.pause();
+        values = input;
+        scope.resume();
+
+        _Sorter()(values);
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Sort, std::uint32_t, std_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, std::uint32_t, pdq_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, std::uint32_t, radix_sorter)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_Sort, std::uint64_t, std_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, std::uint64_t, pdq_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, std::uint64_t, radix_sorter)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_Sort, float, std_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, float, pdq_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, float, radix_sorter)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_Sort, record, std_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, record, pdq_sorter)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_Sort, record, radix_sorter)->Apply(cppds_bench::sizes);
@@ -0,0 +1,29 @@
+#include <cppds/stack.hpp>
+
+#include <stack>
+#include <vector>
+
+#include "common.hpp"
+
+template <typename _Stack>
+static void BM_StackPushPop(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        _Stack s;
+        for (std::size_t i = 0; i < n; ++i) {
+            s.push(std::uint32_t(i));
+        }
+        std::uint64_t sum = 0;
+        while (!s.empty()) {
+            sum += s.top();
+            s.pop();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_StackPushPop, cppds::stack<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_StackPushPop, std::stack<std::uint32_t, std::vector<std::uint32_t>>)->Apply(cppds_bench::sizes);
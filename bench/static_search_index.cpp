@@ -0,0 +1,47 @@
+#include <cppds/static_search_index.hpp>
+
+#include <algorithm>
+
+#include "common.hpp"
+
+// Each iteration runs this many searches for keys drawn from the whole range.
+static constexpr std::size_t queries = 4096;
+
+template <typename _Index>
+static void BM_LowerBound(benchmark::State &state) {
+    auto sorted = cppds_bench::keys(state.range(0));
+    std::sort(sorted.begin(), sorted.end());
+
+    const auto lookups = cppds_bench::keys(queries, 0);
+    const std::uint32_t scale = std::uint32_t(state.range(0) / queries + 1);
+
+    const _Index index(sorted.begin(), sorted.end());
+
+    cppds_bench::perf_scope scope(state, queries);
+
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (std::uint32_t key : lookups) {
+            sum += index.lower_bound(key * scale);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+/**
+ * @brief Plain binary search over the sorted keys, for comparison.
+ */
+struct sorted_vector_index {
+    template <typename _InputIt>
+    sorted_vector_index(_InputIt _first, _InputIt _last) : _M_keys(_first, _last) {}
+
+    std::size_t lower_bound(std::uint32_t _key) const {
+        return std::lower_bound(_M_keys.begin(), _M_keys.end(), _key) - _M_keys.begin();
+    }
+
+    std::vector<std::uint32_t> _M_keys;
+};
+
+BENCHMARK_TEMPLATE(BM_LowerBound, sorted_vector_index)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LowerBound, cppds::static_search_index<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_LowerBound, cppds::static_search_tree<std::uint32_t>)->Apply(cppds_bench::sizes);
@@ -0,0 +1,85 @@
+#include <cppds/thread_pool.hpp>
+
+#include <numeric>
+
+#include "common.hpp"
+
+// Bandwidth-bound loops over one large vector, sequential and on pools of
+// 1 to 8 workers.
+static constexpr std::int64_t parallel_size =
+    CPPDS_BENCH_MAX_SIZE < (std::int64_t(1) << 26) ? CPPDS_BENCH_MAX_SIZE : std::int64_t(1) << 26;
+
+static cppds::vector<std::uint64_t> make_data() {
+    cppds::vector<std::uint64_t> data;
+    data.resize(parallel_size);
+    std::iota(data.begin(), data.end(), std::uint64_t(0));
+    return data;
+}
+
+static void BM_SequentialSum(benchmark::State &state) {
+    const auto data = make_data();
+
+    cppds_bench::perf_scope scope(state, data.size());
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            sum += data[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_ParallelReduceSum(benchmark::State &state) {
+    const auto data = make_data();
+    cppds::thread_pool pool(state.range(0));
+
+    cppds_bench::perf_scope scope(state, data.size());
+
+    for (auto _ : state) {
+        std::uint64_t sum = pool.parallel_reduce(0, data.size(), 0, std::uint64_t(0),
+            [&](std::size_t _begin, std::size_t _end) {
+                std::uint64_t partial = 0;
+                for (std::size_t i = _begin; i < _end; ++i) {
+                    partial += data[i];
+                }
+                return partial;
+            },
+            [](std::uint64_t _a, std::uint64_t _b) { return _a + _b; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void BM_ParallelForTransform(benchmark::State &state) {
+    auto data = make_data();
+    cppds::thread_pool pool(state.range(0));
+
+    cppds_bench::perf_scope scope(state, data.size());
+
+    for (auto _ : state) {
+        pool.parallel_for(0, data.size(), 0, [&](std::size_t i) {
+            data[i] = data[i] * 0x9e3779b97f4a7c15ull + 1;
+        });
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_ParallelForFineGrained(benchmark::State &state) {
+    auto data = make_data();
+    cppds::thread_pool pool(state.range(0));
+
+    // One task per 1024 elements measures the fork/join overhead.
+    cppds_bench::perf_scope scope(state, data.size() / 1024);
+
+    for (auto _ : state) {
+        pool.parallel_for(0, data.size(), 1024, [&](std::size_t i) {
+            data[i] += 1;
+        });
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(BM_SequentialSum)->UseRealTime();
+BENCHMARK(BM_ParallelReduceSum)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_ParallelForTransform)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_ParallelForFineGrained)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
@@ -0,0 +1,79 @@
+#include <cppds/indexed_priority_queue.hpp>
+#include <cppds/timer_wheel.hpp>
+
+#include <memory>
+
+#include "common.hpp"
+
+// Idle timeouts of state.range(0) connections, each rearmed when it sees
+// traffic. Activity hits the connections in a random order and the clock
+// ticks every 64 rearms. Each connection is rearmed about every count / 64
+// ticks and its timeout is twice that plus jitter, so most timers are rearmed
+// long before they expire, as on a busy server, while the ones rearmed late in
+// a round can still run out.
+
+static constexpr std::uint64_t ops_per_tick = 64;
+
+static std::uint64_t timeout(std::size_t _count, std::uint32_t _key) {
+    return 2 * (_count / ops_per_tick) + (_key & 1023);
+}
+
+static void BM_TimerWheelRearm(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds::timer_wheel wheel;
+    std::size_t expired = 0;
+    std::unique_ptr<cppds::timer[]> timers(new cppds::timer[keys.size()]);
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        timers[i].set_callback([&expired] { ++expired; });
+        wheel.schedule_after(timers[i], timeout(keys.size(), keys[i]));
+    }
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            wheel.schedule_after(timers[keys[i]], timeout(keys.size(), keys[i]));
+
+            if (i % ops_per_tick == 0) {
+                wheel.advance(wheel.now() + 1);
+            }
+        }
+    }
+
+    state.counters["expired"] = double(expired);
+}
+
+static void BM_IndexedHeapRearm(benchmark::State &state) {
+    const auto keys = cppds_bench::keys(state.range(0));
+
+    cppds::indexed_priority_queue<std::uint64_t> heap(keys.size());
+    std::uint64_t now = 0;
+    std::size_t expired = 0;
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        heap.push(i, timeout(keys.size(), keys[i]));
+    }
+
+    cppds_bench::perf_scope scope(state, keys.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            heap.update(keys[i], now + timeout(keys.size(), keys[i]));
+
+            if (i % ops_per_tick == 0) {
+                ++now;
+                while (!heap.empty() && heap.top() <= now) {
+                    heap.pop();
+                    ++expired;
+                }
+            }
+        }
+    }
+
+    state.counters["expired"] = double(expired);
+}
+
+BENCHMARK(BM_TimerWheelRearm)->Apply(cppds_bench::sizes_upto<1 << 24>);
+BENCHMARK(BM_IndexedHeapRearm)->Apply(cppds_bench::sizes_upto<1 << 24>);
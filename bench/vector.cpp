@@ -0,0 +1,90 @@
+#include <cppds/vector.hpp>
+
+#include <vector>
+
+#include "common.hpp"
+
+template <typename _Vector>
+static void BM_VectorPushBack(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        _Vector v;
+        for (std::size_t i = 0; i < n; ++i) {
+            v.push_back(std::uint32_t(i));
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+template <typename _Vector>
+static void BM_VectorPopBack(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        scope.pause();
+        _Vector v;
+        for (std::size_t i = 0; i < n; ++i) {
+            v.push_back(std::uint32_t(i));
+        }
+        scope.resume();
+
+        while (!v.empty()) {
+            v.pop_back();
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+template <typename _Vector>
+static void BM_VectorIterate(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    _Vector v;
+    for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(std::uint32_t(i));
+    }
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            sum += v[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+template <typename _Vector>
+static void BM_VectorCopy(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+
+    _Vector v;
+    for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(std::uint32_t(i));
+    }
+
+    cppds_bench::perf_scope scope(state, n);
+
+    for (auto _ : state) {
+        _Vector copy = v;
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_VectorPushBack, cppds::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_VectorPushBack, std::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_VectorPopBack, cppds::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_VectorPopBack, std::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_VectorIterate, cppds::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_VectorIterate, std::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+
+BENCHMARK_TEMPLATE(BM_VectorCopy, cppds::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
+BENCHMARK_TEMPLATE(BM_VectorCopy, std::vector<std::uint32_t>)->Apply(cppds_bench::sizes);
@@ -0,0 +1,163 @@
+#include <cppds/work_stealing_deque.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "common.hpp"
+
+// Fork-join recursion: fib(n) splits into fib(n - 1) and fib(n - 2) tasks
+// until n drops below the cutoff, and leaves are computed sequentially.
+static constexpr int fib_n = 32;
+static constexpr int fib_cutoff = 12;
+
+static std::uint64_t fib(int _n) {
+    return _n < 2 ? std::uint64_t(_n) : fib(_n - 1) + fib(_n - 2);
+}
+
+static std::uint64_t leaves(int _n) {
+    return _n < fib_cutoff ? 1 : leaves(_n - 1) + leaves(_n - 2);
+}
+
+/**
+ * @brief The tasks of one worker, a Chase-Lev deque.
+ */
+class stealing_queue {
+public:
+    void push(int _task) {
+        _M_deque.push(_task);
+    }
+
+    bool pop(int &_task) {
+        return _M_deque.pop(_task);
+    }
+
+    bool steal(int &_task) {
+        return _M_deque.steal(_task);
+    }
+
+protected:
+    cppds::work_stealing_deque<int> _M_deque;
+};
+
+/**
+ * @brief The tasks of one worker, a std::deque behind a mutex, for comparison.
+ */
+class locked_queue {
+public:
+    void push(int _task) {
+        std::lock_guard<std::mutex> lock(_M_mutex);
+        _M_deque.push_back(_task);
+    }
+
+    bool pop(int &_task) {
+        std::lock_guard<std::mutex> lock(_M_mutex);
+        if (_M_deque.empty()) {
+            return false;
+        }
+        _task = _M_deque.back();
+        _M_deque.pop_back();
+        return true;
+    }
+
+    bool steal(int &_task) {
+        std::lock_guard<std::mutex> lock(_M_mutex);
+        if (_M_deque.empty()) {
+            return false;
+        }
+        _task = _M_deque.front();
+        _M_deque.pop_front();
+        return true;
+    }
+
+protected:
+    std::mutex _M_mutex;
+    std::deque<int> _M_deque;
+};
+
+template <typename _Queue>
+static std::uint64_t fork_join(std::size_t _workers) {
+    std::unique_ptr<_Queue[]> queues(new _Queue[_workers]);
+    std::atomic<std::uint64_t> remaining {leaves(fib_n)};
+    std::atomic<std::uint64_t> result {0};
+
+    queues[0].push(fib_n);
+
+    auto work = [&](std::size_t _self) {
+        std::uint64_t rng = 0x9e3779b97f4a7c15ull * (_self + 1);
+        std::uint64_t sum = 0;
+        int task = 0;
+
+        while (remaining.load(std::memory_order_relaxed) > 0) {
+            if (!queues[_self].pop(task)) {
+                rng ^= rng << 13;
+                rng ^= rng >> 7;
+                rng ^= rng << 17;
+
+                std::size_t victim = rng % _workers;
+                if (victim == _self || !queues[victim].steal(task)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+            }
+
+            while (task >= fib_cutoff) {
+                queues[_self].push(task - 2);
+                --task;
+            }
+
+            sum += fib(task);
+            remaining.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        result.fetch_add(sum);
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < _workers; ++i) {
+        threads.emplace_back(work, i);
+    }
+
+    work(0);
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    return result.load();
+}
+
+template <typename _Queue>
+static void BM_ForkJoinFib(benchmark::State &state) {
+    cppds_bench::perf_scope scope(state, leaves(fib_n));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fork_join<_Queue>(state.range(0)));
+    }
+}
+
+static void BM_WorkStealingDequePushPop(benchmark::State &state) {
+    cppds::work_stealing_deque<std::uint64_t> d;
+    const std::size_t count = state.range(0);
+
+    cppds_bench::perf_scope scope(state, count);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            d.push(i);
+        }
+
+        std::uint64_t sum = 0, value = 0;
+        while (d.pop(value)) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_WorkStealingDequePushPop)->Apply(cppds_bench::sizes_upto<1 << 20>);
+
+BENCHMARK_TEMPLATE(BM_ForkJoinFib, stealing_queue)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForkJoinFib, locked_queue)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
@@ -0,0 +1,1202 @@
+/**
+ * @file art_map.hpp
+ * @brief An ordered map stored in an adaptive radix tree.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For fixed-width integer types
+#include <cstring>              ///< For std::memcpy and std::memmove
+#include <initializer_list>     ///< For std::initializer_list
+#include <stdexcept>            ///< For std::out_of_range exception
+#include <string>               ///< For std::string
+#include <string_view>          ///< For std::string_view
+#include <type_traits>          ///< For std::enable_if_t and std::make_unsigned_t
+#include <utility>              ///< For std::declval
+
+#include "pair.hpp"
+#include "simd.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief The binary-comparable bytes of a key.
+     *
+     * Comparing the bytes as unsigned characters orders the keys: strings are
+     * their own bytes, and integers are stored big-endian with the sign bit
+     * flipped.
+     */
+    template <typename _kTp, typename = void>
+    struct __art_key;
+
+    template <>
+    struct __art_key<std::string> {
+        explicit __art_key(const std::string &_key) : _M_bytes(_key) {}
+
+        std::string_view bytes() const {
+            return this->_M_bytes;
+        }
+
+        static const std::string &decode(const std::string &_bytes) {
+            return _bytes;
+        }
+
+        std::string_view _M_bytes;
+    };
+
+    template <typename _kTp>
+    struct __art_key<_kTp, std::enable_if_t<std::is_integral<_kTp>::value && !std::is_same<_kTp, bool>::value>> {
+        using __unsigned = std::make_unsigned_t<_kTp>;
+
+        static constexpr __unsigned __sign =
+            std::is_signed<_kTp>::value ? __unsigned(__unsigned(1) << (8 * sizeof(_kTp) - 1)) : __unsigned(0);
+
+        explicit __art_key(_kTp _key) {
+            __unsigned bits = __unsigned(__unsigned(_key) ^ __sign);
+            for (std::size_t i = sizeof(_kTp); i-- > 0; ) {
+                this->_M_bytes[i] = char(bits & 0xff);
+                bits = __unsigned(bits >> 4 >> 4);
+            }
+        }
+
+        std::string_view bytes() const {
+            return std::string_view(this->_M_bytes, sizeof(_kTp));
+        }
+
+        static _kTp decode(const std::string &_bytes) {
+            __unsigned bits = 0;
+            for (char byte : _bytes) {
+                bits = __unsigned(__unsigned(bits << 4 << 4) | (unsigned char) byte);
+            }
+            return _kTp(__unsigned(bits ^ __sign));
+        }
+
+        char _M_bytes[sizeof(_kTp)];
+    };
+
+    /**
+     * @brief An ordered map stored in an adaptive radix tree.
+     *
+     * Keys are split into bytes and each inner node branches on one byte,
+     * growing from 4 to 16, 48 and 256 children as needed, so sparse nodes
+     * stay small and dense ones index directly. Chains of single-child nodes
+     * are collapsed into a prefix stored in the node (path compression),
+     * and a key is kept in a leaf as soon as no other key shares its path
+     * (lazy expansion). Node16 is searched with SSE2. A key that is a prefix
+     * of other keys is kept in the inner node where it ends.
+     *
+     * Entries are visited in the order of their bytes, which is the usual
+     * order for strings and for integers. Supported key types are std::string
+     * and the integer types.
+     *
+     * @tparam _kTp The type of keys in the map.
+     * @tparam _vTp The type of values in the map.
+     */
+    template <typename _kTp, typename _vTp>
+    class art_map {
+    protected:
+        using __key = __art_key<_kTp>;
+        using __pair_type = cppds::pair<_kTp, _vTp>;
+
+        /// The prefix bytes stored in a node; longer prefixes are checked at the leaf.
+        static constexpr std::size_t __max_prefix = 12;
+
+        enum __type : std::uint8_t {
+            __leaf_type,
+            __node4_type,
+            __node16_type,
+            __node48_type,
+            __node256_type,
+        };
+
+        struct __node {
+            __type _M_type = __leaf_type;
+        };
+
+        struct __leaf : __node {
+            std::string _M_key;             // The key bytes
+            _vTp _M_value;                  // The value
+
+            __leaf(std::string_view _key, const _vTp &_value) : _M_key(_key), _M_value(_value) {}
+        };
+
+        struct __inner : __node {
+            std::uint16_t _M_count = 0;                     // The number of children
+            std::uint32_t _M_prefix_len = 0;                // The length of the compressed path
+            unsigned char _M_prefix[__max_prefix] {};       // Its first bytes
+            __leaf *_M_value_leaf = nullptr;                // The entry whose key ends here
+        };
+
+        struct __node4 : __inner {
+            unsigned char _M_keys[4] {};
+            __node *_M_children[4] {};
+
+            __node4() {
+                this->_M_type = __node4_type;
+            }
+        };
+
+        struct __node16 : __inner {
+            unsigned char _M_keys[16] {};
+            __node *_M_children[16] {};
+
+            __node16() {
+                this->_M_type = __node16_type;
+            }
+        };
+
+        struct __node48 : __inner {
+            unsigned char _M_index[256] {};                 // Child slot + 1 per byte, 0 if absent
+            __node *_M_children[48] {};
+
+            __node48() {
+                this->_M_type = __node48_type;
+            }
+        };
+
+        struct __node256 : __inner {
+            __node *_M_children[256] {};
+
+            __node256() {
+                this->_M_type = __node256_type;
+            }
+        };
+
+    public:
+        using key_type = _kTp;              ///< The type of keys in the map.
+        using value_type = _vTp;            ///< The type of values in the map.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /**
+         * @brief Default constructor.
+         */
+        art_map() = default;
+
+        /**
+         * @brief Constructor that inserts an initializer list of key-value pairs.
+         *
+         * @param _list An initializer list of key-value pairs.
+         */
+        art_map(const std::initializer_list<__pair_type> &_list) {
+            operator=(_list);
+        }
+
+        /**
+         * @brief Copy constructor.
+         */
+        art_map(const art_map &_other) : _M_root(__clone(_other._M_root)), _M_size(_other._M_size) {}
+
+        /**
+         * @brief Move constructor.
+         */
+        art_map(art_map &&_other) noexcept : _M_root(_other._M_root), _M_size(_other._M_size) {
+            _other._M_root = nullptr;
+            _other._M_size = 0;
+        }
+
+        art_map &operator=(const art_map &_other) {
+            if (this != &_other) {
+                art_map copy(_other);
+                this->swap(copy);
+            }
+            return *this;
+        }
+
+        art_map &operator=(art_map &&_other) noexcept {
+            if (this != &_other) {
+                this->clear();
+                this->swap(_other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator to assign key-value pairs from an initializer list.
+         *
+         * @param _list An initializer list of key-value pairs.
+         * @return A reference to the modified map.
+         */
+        art_map &operator=(const std::initializer_list<__pair_type> &_list) {
+            this->clear();
+            for (const __pair_type &pair : _list) {
+                this->insert(pair.first, pair.second);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor. Frees every node.
+         */
+        ~art_map() {
+            this->clear();
+        }
+
+        /**
+         * @brief Insert a key-value pair, replacing the value of an existing key.
+         *
+         * @param _key The key to insert.
+         * @param _value The corresponding value to insert.
+         * @return `true` if the key was new, `false` if its value was replaced.
+         */
+        bool insert(const key_type &_key, const value_type &_value) {
+            bool inserted;
+            __leaf *leaf = __insert(__key(_key).bytes(), _value, inserted);
+
+            if (!inserted) {
+                leaf->_M_value = _value;
+            }
+
+            return inserted;
+        }
+
+        /**
+         * @brief Access the value of a key, inserting a value-initialized one if it is absent.
+         *
+         * @param _key The key to look up.
+         * @return A reference to the value.
+         */
+        value_type &operator[](const key_type &_key) {
+            bool inserted;
+            return __insert(__key(_key).bytes(), value_type(), inserted)->_M_value;
+        }
+
+        /**
+         * @brief Erase a key and its value.
+         *
+         * @param _key The key to erase.
+         * @return `true` if the key was erased, `false` if it was absent.
+         */
+        bool erase(const key_type &_key) {
+            return __erase(this->_M_root, __key(_key).bytes(), 0);
+        }
+
+        /**
+         * @brief Find the value of a key.
+         *
+         * @param _key The key to find.
+         * @return A pointer to the value, or nullptr if the key is absent.
+         */
+        value_type *find(const key_type &_key) {
+            __leaf *leaf = __lookup(__key(_key).bytes());
+            return leaf ? &leaf->_M_value : nullptr;
+        }
+
+        /**
+         * @brief Find the value of a key (const version).
+         *
+         * @param _key The key to find.
+         * @return A pointer to the value, or nullptr if the key is absent.
+         */
+        const value_type *find(const key_type &_key) const {
+            __leaf *leaf = __lookup(__key(_key).bytes());
+            return leaf ? &leaf->_M_value : nullptr;
+        }
+
+        /**
+         * @brief Check if a key exists in the map.
+         *
+         * @param _key The key to check for.
+         * @return `true` if the key exists in the map, `false` otherwise.
+         */
+        bool contains(const key_type &_key) const {
+            return __lookup(__key(_key).bytes()) != nullptr;
+        }
+
+        /**
+         * @brief Access the value of a key.
+         *
+         * @param _key The key to look up.
+         * @return A reference to the value.
+         * @throw std::out_of_range if the key is absent.
+         */
+        value_type &at(const key_type &_key) {
+            value_type *value = this->find(_key);
+
+            if (!value) {
+                throw std::out_of_range("key not found");
+            }
+
+            return *value;
+        }
+
+        /**
+         * @brief Access the value of a key (const version).
+         *
+         * @param _key The key to look up.
+         * @return A const reference to the value.
+         * @throw std::out_of_range if the key is absent.
+         */
+        const value_type &at(const key_type &_key) const {
+            const value_type *value = this->find(_key);
+
+            if (!value) {
+                throw std::out_of_range("key not found");
+            }
+
+            return *value;
+        }
+
+        /**
+         * @brief Visit every entry in key order.
+         *
+         * @param _func Called as `_func(key, value)` for each entry.
+         */
+        template <typename _Func>
+        void for_each(_Func _func) const {
+            if (this->_M_root) {
+                __walk(this->_M_root, _func);
+            }
+        }
+
+        /**
+         * @brief Visit, in key order, the entries whose key bytes start with a prefix.
+         *
+         * For std::string keys the bytes are the characters; for integers
+         * they are big-endian, so e.g. a one-byte prefix selects a range of
+         * 2^(8 * (sizeof(key) - 1)) keys.
+         *
+         * @param _prefix The prefix of the key bytes.
+         * @param _func Called as `_func(key, value)` for each entry.
+         */
+        template <typename _Func>
+        void for_each_prefix(std::string_view _prefix, _Func _func) const {
+            const __node *node = this->_M_root;
+            size_type depth = 0;
+
+            while (node) {
+                if (node->_M_type == __leaf_type) {
+                    const __leaf *leaf = static_cast<const __leaf *>(node);
+                    if (__starts_with(leaf->_M_key, _prefix)) {
+                        _func(__key::decode(leaf->_M_key), leaf->_M_value);
+                    }
+                    return;
+                }
+
+                const __inner *inner = static_cast<const __inner *>(node);
+
+                // Every key below shares the bytes up to the end of the node's
+                // prefix, so a single one decides for the whole subtree.
+                if (depth + inner->_M_prefix_len >= _prefix.size()) {
+                    if (__starts_with(__minimum(inner)->_M_key, _prefix)) {
+                        __walk(inner, _func);
+                    }
+                    return;
+                }
+
+                if (!__stored_prefix_matches(inner, _prefix, depth)) {
+                    return;
+                }
+                depth += inner->_M_prefix_len;
+
+                __node *const *child = __find_child(inner, __byte(_prefix, depth));
+                if (!child) {
+                    return;
+                }
+
+                node = *child;
+                ++depth;
+            }
+        }
+
+        /**
+         * @brief Collect, in key order, the entries whose key bytes start with a prefix.
+         *
+         * @param _prefix The prefix of the key bytes.
+         * @return The matching key-value pairs.
+         */
+        vector<__pair_type> prefix_scan(std::string_view _prefix) const {
+            vector<__pair_type> result;
+
+            this->for_each_prefix(_prefix, [&result](const key_type &_key, const value_type &_value) {
+                result.push_back(__pair_type(_key, _value));
+            });
+
+            return result;
+        }
+
+        /**
+         * @brief Remove every entry and free every node.
+         */
+        void clear() {
+            if (this->_M_root) {
+                __free(this->_M_root);
+            }
+
+            this->_M_root = nullptr;
+            this->_M_size = 0;
+        }
+
+        /**
+         * @brief Swap the contents with another map.
+         *
+         * @param _other The map to swap with.
+         */
+        void swap(art_map &_other) noexcept {
+            std::swap(this->_M_root, _other._M_root);
+            std::swap(this->_M_size, _other._M_size);
+        }
+
+        /**
+         * @brief Get the size of the map.
+         *
+         * @return The number of key-value pairs in the map.
+         */
+        size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Check if the map is empty.
+         *
+         * @return `true` if the map is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_size == 0;
+        }
+
+    protected:
+        static unsigned char __byte(std::string_view _bytes, size_type _index) {
+            return (unsigned char) _bytes[_index];
+        }
+
+        static bool __starts_with(std::string_view _bytes, std::string_view _prefix) {
+            return _bytes.size() >= _prefix.size() && _bytes.compare(0, _prefix.size(), _prefix) == 0;
+        }
+
+        /**
+         * @brief Compare keys byte by byte; keys are short, so this avoids a call to memcmp.
+         */
+        static bool __equal(std::string_view _a, std::string_view _b) {
+            if (_a.size() != _b.size()) {
+                return false;
+            }
+
+            for (size_type i = 0; i < _a.size(); ++i) {
+                if (_a[i] != _b[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Check the stored bytes of a node's prefix against a key from a depth.
+         */
+        static bool __stored_prefix_matches(const __inner *_inner, std::string_view _key, size_type _depth) {
+            size_type stored = std::min<size_type>(_inner->_M_prefix_len, __max_prefix);
+
+            for (size_type i = 0; i < stored; ++i) {
+                if (_inner->_M_prefix[i] != __byte(_key, _depth + i)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        static void __set_prefix(__inner *_inner, const char *_bytes, size_type _length) {
+            _inner->_M_prefix_len = std::uint32_t(_length);
+            std::memmove(_inner->_M_prefix, _bytes, std::min(_length, __max_prefix));
+        }
+
+        static void __copy_header(__inner *_dst, const __inner *_src) {
+            _dst->_M_count = _src->_M_count;
+            _dst->_M_prefix_len = _src->_M_prefix_len;
+            std::memcpy(_dst->_M_prefix, _src->_M_prefix, __max_prefix);
+            _dst->_M_value_leaf = _src->_M_value_leaf;
+        }
+
+        static __node *const *__find_child(const __inner *_inner, unsigned char _byte) {
+            switch (_inner->_M_type) {
+            case __node4_type: {
+                const __node4 *node = static_cast<const __node4 *>(_inner);
+                for (unsigned i = 0; i < node->_M_count; ++i) {
+                    if (node->_M_keys[i] == _byte) {
+                        return &node->_M_children[i];
+                    }
+                }
+                return nullptr;
+            }
+            case __node16_type: {
+                const __node16 *node = static_cast<const __node16 *>(_inner);
+                unsigned i = __find_byte16(node->_M_keys, node->_M_count, _byte);
+                return i < node->_M_count ? &node->_M_children[i] : nullptr;
+            }
+            case __node48_type: {
+                const __node48 *node = static_cast<const __node48 *>(_inner);
+                unsigned slot = node->_M_index[_byte];
+                return slot ? &node->_M_children[slot - 1] : nullptr;
+            }
+            default: {
+                const __node256 *node = static_cast<const __node256 *>(_inner);
+                return node->_M_children[_byte] ? &node->_M_children[_byte] : nullptr;
+            }
+            }
+        }
+
+        static __node **__find_child(__inner *_inner, unsigned char _byte) {
+            return const_cast<__node **>(__find_child(static_cast<const __inner *>(_inner), _byte));
+        }
+
+        /**
+         * @brief Find the leaf with the smallest key below a node.
+         */
+        static const __leaf *__minimum(const __node *_node) {
+            while (_node->_M_type != __leaf_type) {
+                const __inner *inner = static_cast<const __inner *>(_node);
+
+                if (inner->_M_value_leaf) {
+                    return inner->_M_value_leaf;
+                }
+
+                switch (inner->_M_type) {
+                case __node4_type:
+                    _node = static_cast<const __node4 *>(inner)->_M_children[0];
+                    break;
+                case __node16_type:
+                    _node = static_cast<const __node16 *>(inner)->_M_children[0];
+                    break;
+                case __node48_type: {
+                    const __node48 *node = static_cast<const __node48 *>(inner);
+                    unsigned byte = 0;
+                    while (!node->_M_index[byte]) {
+                        ++byte;
+                    }
+                    _node = node->_M_children[node->_M_index[byte] - 1];
+                    break;
+                }
+                default: {
+                    const __node256 *node = static_cast<const __node256 *>(inner);
+                    unsigned byte = 0;
+                    while (!node->_M_children[byte]) {
+                        ++byte;
+                    }
+                    _node = node->_M_children[byte];
+                    break;
+                }
+                }
+            }
+
+            return static_cast<const __leaf *>(_node);
+        }
+
+        __leaf *__lookup(std::string_view _key) const {
+            const __node *node = this->_M_root;
+            size_type depth = 0;
+
+            while (node) {
+                if (node->_M_type == __leaf_type) {
+                    const __leaf *leaf = static_cast<const __leaf *>(node);
+                    return __equal(leaf->_M_key, _key) ? const_cast<__leaf *>(leaf) : nullptr;
+                }
+
+                const __inner *inner = static_cast<const __inner *>(node);
+
+                if (inner->_M_prefix_len) {
+                    if (depth + inner->_M_prefix_len > _key.size()) {
+                        return nullptr;
+                    }
+
+                    // Only the stored bytes are checked; the leaf compares the whole key.
+                    if (!__stored_prefix_matches(inner, _key, depth)) {
+                        return nullptr;
+                    }
+
+                    depth += inner->_M_prefix_len;
+                }
+
+                if (depth == _key.size()) {
+                    const __leaf *leaf = inner->_M_value_leaf;
+                    return leaf && __equal(leaf->_M_key, _key) ? const_cast<__leaf *>(leaf) : nullptr;
+                }
+
+                __node *const *child = __find_child(inner, __byte(_key, depth));
+                if (!child) {
+                    return nullptr;
+                }
+
+                node = *child;
+                ++depth;
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * @brief The length of the common part of a node's prefix and a key from a depth.
+         */
+        static size_type __prefix_mismatch(const __inner *_inner, std::string_view _key, size_type _depth) {
+            size_type limit = std::min<size_type>(_inner->_M_prefix_len, _key.size() - _depth);
+            size_type stored = std::min<size_type>(limit, __max_prefix);
+            size_type i = 0;
+
+            for (; i < stored; ++i) {
+                if (_inner->_M_prefix[i] != __byte(_key, _depth + i)) {
+                    return i;
+                }
+            }
+
+            if (i < limit) {
+                std::string_view full = __minimum(_inner)->_M_key;
+                for (; i < limit; ++i) {
+                    if (full[_depth + i] != _key[_depth + i]) {
+                        return i;
+                    }
+                }
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief Hang a leaf below a fresh node whose prefix ends at _depth.
+         */
+        static void __attach(__node *&_node, __leaf *_leaf, size_type _depth) {
+            if (_leaf->_M_key.size() == _depth) {
+                static_cast<__inner *>(_node)->_M_value_leaf = _leaf;
+            } else {
+                __add_child(_node, __byte(_leaf->_M_key, _depth), _leaf);
+            }
+        }
+
+        /**
+         * @brief Find the leaf of a key, inserting it with a value if it is absent.
+         */
+        __leaf *__insert(std::string_view _key, const value_type &_value, bool &_inserted) {
+            __node **slot = &this->_M_root;
+            size_type depth = 0;
+
+            _inserted = true;
+
+            while (*slot) {
+                __node *node = *slot;
+
+                if (node->_M_type == __leaf_type) {
+                    __leaf *leaf = static_cast<__leaf *>(node);
+
+                    if (__equal(leaf->_M_key, _key)) {
+                        _inserted = false;
+                        return leaf;
+                    }
+
+                    // Lazy expansion ends here: branch where the two keys diverge.
+                    size_type common = 0;
+                    size_type limit = std::min(leaf->_M_key.size(), _key.size());
+                    while (depth + common < limit && leaf->_M_key[depth + common] == _key[depth + common]) {
+                        ++common;
+                    }
+
+                    __node *branch = new __node4();
+                    __set_prefix(static_cast<__inner *>(branch), _key.data() + depth, common);
+
+                    __leaf *added = new __leaf(_key, _value);
+                    __attach(branch, leaf, depth + common);
+                    __attach(branch, added, depth + common);
+
+                    *slot = branch;
+                    ++this->_M_size;
+                    return added;
+                }
+
+                __inner *inner = static_cast<__inner *>(node);
+
+                if (inner->_M_prefix_len) {
+                    size_type common = __prefix_mismatch(inner, _key, depth);
+
+                    if (common < inner->_M_prefix_len) {
+                        // Split the compressed path where the key leaves it.
+                        const unsigned char *full = inner->_M_prefix_len <= __max_prefix
+                            ? inner->_M_prefix
+                            : reinterpret_cast<const unsigned char *>(__minimum(inner)->_M_key.data()) + depth;
+
+                        __node *branch = new __node4();
+                        __set_prefix(static_cast<__inner *>(branch), _key.data() + depth, common);
+
+                        unsigned char byte = full[common];
+                        __set_prefix(inner, reinterpret_cast<const char *>(full) + common + 1,
+                            inner->_M_prefix_len - common - 1);
+                        __add_child(branch, byte, inner);
+
+                        __leaf *added = new __leaf(_key, _value);
+                        __attach(branch, added, depth + common);
+
+                        *slot = branch;
+                        ++this->_M_size;
+                        return added;
+                    }
+
+                    depth += inner->_M_prefix_len;
+                }
+
+                if (depth == _key.size()) {
+                    if (inner->_M_value_leaf) {
+                        _inserted = false;
+                        return inner->_M_value_leaf;
+                    }
+
+                    inner->_M_value_leaf = new __leaf(_key, _value);
+                    ++this->_M_size;
+                    return inner->_M_value_leaf;
+                }
+
+                __node **child = __find_child(inner, __byte(_key, depth));
+
+                if (!child) {
+                    __leaf *added = new __leaf(_key, _value);
+                    __add_child(*slot, __byte(_key, depth), added);
+                    ++this->_M_size;
+                    return added;
+                }
+
+                slot = child;
+                ++depth;
+            }
+
+            __leaf *added = new __leaf(_key, _value);
+            *slot = added;
+            ++this->_M_size;
+            return added;
+        }
+
+        /**
+         * @brief Add a child under a new byte, growing the node when it is full.
+         */
+        static void __add_child(__node *&_node, unsigned char _byte, __node *_child) {
+            switch (_node->_M_type) {
+            case __node4_type: {
+                __node4 *node = static_cast<__node4 *>(_node);
+
+                if (node->_M_count < 4) {
+                    unsigned pos = 0;
+                    while (pos < node->_M_count && node->_M_keys[pos] < _byte) {
+                        ++pos;
+                    }
+                    for (unsigned i = node->_M_count; i > pos; --i) {
+                        node->_M_keys[i] = node->_M_keys[i - 1];
+                        node->_M_children[i] = node->_M_children[i - 1];
+                    }
+                    node->_M_keys[pos] = _byte;
+                    node->_M_children[pos] = _child;
+                    ++node->_M_count;
+                    return;
+                }
+
+                __node16 *grown = new __node16();
+                __copy_header(grown, node);
+                std::memcpy(grown->_M_keys, node->_M_keys, 4);
+                std::memcpy(grown->_M_children, node->_M_children, 4 * sizeof(__node *));
+                delete node;
+                _node = grown;
+                break;
+            }
+            case __node16_type: {
+                __node16 *node = static_cast<__node16 *>(_node);
+
+                if (node->_M_count < 16) {
+                    unsigned pos = __count_less_bytes16(node->_M_keys, node->_M_count, _byte);
+                    for (unsigned i = node->_M_count; i > pos; --i) {
+                        node->_M_keys[i] = node->_M_keys[i - 1];
+                        node->_M_children[i] = node->_M_children[i - 1];
+                    }
+                    node->_M_keys[pos] = _byte;
+                    node->_M_children[pos] = _child;
+                    ++node->_M_count;
+                    return;
+                }
+
+                __node48 *grown = new __node48();
+                __copy_header(grown, node);
+                for (unsigned i = 0; i < 16; ++i) {
+                    grown->_M_index[node->_M_keys[i]] = (unsigned char) (i + 1);
+                    grown->_M_children[i] = node->_M_children[i];
+                }
+                delete node;
+                _node = grown;
+                break;
+            }
+            case __node48_type: {
+                __node48 *node = static_cast<__node48 *>(_node);
+
+                if (node->_M_count < 48) {
+                    unsigned slot = 0;
+                    while (node->_M_children[slot]) {
+                        ++slot;
+                    }
+                    node->_M_index[_byte] = (unsigned char) (slot + 1);
+                    node->_M_children[slot] = _child;
+                    ++node->_M_count;
+                    return;
+                }
+
+                __node256 *grown = new __node256();
+                __copy_header(grown, node);
+                for (unsigned byte = 0; byte < 256; ++byte) {
+                    if (node->_M_index[byte]) {
+                        grown->_M_children[byte] = node->_M_children[node->_M_index[byte] - 1];
+                    }
+                }
+                delete node;
+                _node = grown;
+                break;
+            }
+            default: {
+                __node256 *node = static_cast<__node256 *>(_node);
+                node->_M_children[_byte] = _child;
+                ++node->_M_count;
+                return;
+            }
+            }
+
+            __add_child(_node, _byte, _child);
+        }
+
+        /**
+         * @brief Remove the child under a byte, shrinking the node when it gets sparse.
+         */
+        static void __remove_child(__node *&_node, unsigned char _byte) {
+            switch (_node->_M_type) {
+            case __node4_type: {
+                __node4 *node = static_cast<__node4 *>(_node);
+                unsigned pos = 0;
+                while (node->_M_keys[pos] != _byte) {
+                    ++pos;
+                }
+                for (unsigned i = pos + 1; i < node->_M_count; ++i) {
+                    node->_M_keys[i - 1] = node->_M_keys[i];
+                    node->_M_children[i - 1] = node->_M_children[i];
+                }
+                --node->_M_count;
+                return;
+            }
+            case __node16_type: {
+                __node16 *node = static_cast<__node16 *>(_node);
+                unsigned pos = __find_byte16(node->_M_keys, node->_M_count, _byte);
+                for (unsigned i = pos + 1; i < node->_M_count; ++i) {
+                    node->_M_keys[i - 1] = node->_M_keys[i];
+                    node->_M_children[i - 1] = node->_M_children[i];
+                }
+                --node->_M_count;
+
+                if (node->_M_count <= 3) {
+                    __node4 *shrunk = new __node4();
+                    __copy_header(shrunk, node);
+                    std::memcpy(shrunk->_M_keys, node->_M_keys, node->_M_count);
+                    std::memcpy(shrunk->_M_children, node->_M_children, node->_M_count * sizeof(__node *));
+                    delete node;
+                    _node = shrunk;
+                }
+                return;
+            }
+            case __node48_type: {
+                __node48 *node = static_cast<__node48 *>(_node);
+                node->_M_children[node->_M_index[_byte] - 1] = nullptr;
+                node->_M_index[_byte] = 0;
+                --node->_M_count;
+
+                if (node->_M_count <= 12) {
+                    __node16 *shrunk = new __node16();
+                    __copy_header(shrunk, node);
+                    unsigned pos = 0;
+                    for (unsigned byte = 0; byte < 256; ++byte) {
+                        if (node->_M_index[byte]) {
+                            shrunk->_M_keys[pos] = (unsigned char) byte;
+                            shrunk->_M_children[pos++] = node->_M_children[node->_M_index[byte] - 1];
+                        }
+                    }
+                    delete node;
+                    _node = shrunk;
+                }
+                return;
+            }
+            default: {
+                __node256 *node = static_cast<__node256 *>(_node);
+                node->_M_children[_byte] = nullptr;
+                --node->_M_count;
+
+                if (node->_M_count <= 37) {
+                    __node48 *shrunk = new __node48();
+                    __copy_header(shrunk, node);
+                    unsigned slot = 0;
+                    for (unsigned byte = 0; byte < 256; ++byte) {
+                        if (node->_M_children[byte]) {
+                            shrunk->_M_index[byte] = (unsigned char) (slot + 1);
+                            shrunk->_M_children[slot++] = node->_M_children[byte];
+                        }
+                    }
+                    delete node;
+                    _node = shrunk;
+                }
+                return;
+            }
+            }
+        }
+
+        /**
+         * @brief Replace a node left with no children, or a single child and no entry, by what remains.
+         */
+        static void __compact(__node *&_node) {
+            __inner *inner = static_cast<__inner *>(_node);
+
+            if (inner->_M_count == 0) {
+                _node = inner->_M_value_leaf;
+                __delete(inner);
+                return;
+            }
+
+            if (inner->_M_count != 1 || inner->_M_value_leaf || inner->_M_type != __node4_type) {
+                return;
+            }
+
+            __node4 *node = static_cast<__node4 *>(inner);
+            __node *child = node->_M_children[0];
+
+            if (child->_M_type != __leaf_type) {
+                // Merge the paths: this prefix, the branch byte, then the child's prefix.
+                __inner *below = static_cast<__inner *>(child);
+                unsigned char merged[__max_prefix];
+                size_type length = std::min<size_type>(node->_M_prefix_len, __max_prefix);
+
+                std::memcpy(merged, node->_M_prefix, length);
+                if (length < __max_prefix) {
+                    merged[length++] = node->_M_keys[0];
+                }
+                size_type rest = std::min<size_type>(below->_M_prefix_len, __max_prefix - length);
+                std::memcpy(merged + length, below->_M_prefix, rest);
+
+                below->_M_prefix_len += node->_M_prefix_len + 1;
+                std::memcpy(below->_M_prefix, merged, __max_prefix);
+            }
+
+            _node = child;
+            delete node;
+        }
+
+        bool __erase(__node *&_node, std::string_view _key, size_type _depth) {
+            if (!_node) {
+                return false;
+            }
+
+            if (_node->_M_type == __leaf_type) {
+                __leaf *leaf = static_cast<__leaf *>(_node);
+
+                if (!__equal(leaf->_M_key, _key)) {
+                    return false;
+                }
+
+                delete leaf;
+                _node = nullptr;
+                --this->_M_size;
+                return true;
+            }
+
+            __inner *inner = static_cast<__inner *>(_node);
+
+            if (inner->_M_prefix_len) {
+                if (_depth + inner->_M_prefix_len > _key.size()) {
+                    return false;
+                }
+
+                if (!__stored_prefix_matches(inner, _key, _depth)) {
+                    return false;
+                }
+
+                _depth += inner->_M_prefix_len;
+            }
+
+            if (_depth == _key.size()) {
+                __leaf *leaf = inner->_M_value_leaf;
+
+                if (!leaf || !__equal(leaf->_M_key, _key)) {
+                    return false;
+                }
+
+                delete leaf;
+                inner->_M_value_leaf = nullptr;
+                --this->_M_size;
+                __compact(_node);
+                return true;
+            }
+
+            unsigned char byte = __byte(_key, _depth);
+            __node **child = __find_child(inner, byte);
+
+            if (!child || !__erase(*child, _key, _depth + 1)) {
+                return false;
+            }
+
+            if (!*child) {
+                __remove_child(_node, byte);
+            }
+
+            __compact(_node);
+            return true;
+        }
+
+        template <typename _Func>
+        static void __walk(const __node *_node, _Func &_func) {
+            if (_node->_M_type == __leaf_type) {
+                const __leaf *leaf = static_cast<const __leaf *>(_node);
+                _func(__key::decode(leaf->_M_key), leaf->_M_value);
+                return;
+            }
+
+            const __inner *inner = static_cast<const __inner *>(_node);
+
+            // A key ending here is a prefix of, and so sorts before, every key below.
+            if (inner->_M_value_leaf) {
+                __walk(inner->_M_value_leaf, _func);
+            }
+
+            switch (inner->_M_type) {
+            case __node4_type: {
+                const __node4 *node = static_cast<const __node4 *>(inner);
+                for (unsigned i = 0; i < node->_M_count; ++i) {
+                    __walk(node->_M_children[i], _func);
+                }
+                break;
+            }
+            case __node16_type: {
+                const __node16 *node = static_cast<const __node16 *>(inner);
+                for (unsigned i = 0; i < node->_M_count; ++i) {
+                    __walk(node->_M_children[i], _func);
+                }
+                break;
+            }
+            case __node48_type: {
+                const __node48 *node = static_cast<const __node48 *>(inner);
+                for (unsigned byte = 0; byte < 256; ++byte) {
+                    if (node->_M_index[byte]) {
+                        __walk(node->_M_children[node->_M_index[byte] - 1], _func);
+                    }
+                }
+                break;
+            }
+            default: {
+                const __node256 *node = static_cast<const __node256 *>(inner);
+                for (unsigned byte = 0; byte < 256; ++byte) {
+                    if (node->_M_children[byte]) {
+                        __walk(node->_M_children[byte], _func);
+                    }
+                }
+                break;
+            }
+            }
+        }
+
+        /**
+         * @brief Apply a function to every child pointer of an inner node.
+         */
+        template <typename _Func>
+        static void __children(__inner *_inner, _Func _func) {
+            switch (_inner->_M_type) {
+            case __node4_type: {
+                __node4 *node = static_cast<__node4 *>(_inner);
+                for (unsigned i = 0; i < node->_M_count; ++i) {
+                    _func(node->_M_children[i]);
+                }
+                break;
+            }
+            case __node16_type: {
+                __node16 *node = static_cast<__node16 *>(_inner);
+                for (unsigned i = 0; i < node->_M_count; ++i) {
+                    _func(node->_M_children[i]);
+                }
+                break;
+            }
+            case __node48_type: {
+                __node48 *node = static_cast<__node48 *>(_inner);
+                for (__node *&child : node->_M_children) {
+                    if (child) {
+                        _func(child);
+                    }
+                }
+                break;
+            }
+            default: {
+                __node256 *node = static_cast<__node256 *>(_inner);
+                for (__node *&child : node->_M_children) {
+                    if (child) {
+                        _func(child);
+                    }
+                }
+                break;
+            }
+            }
+        }
+
+        static __node *__clone(const __node *_node) {
+            if (!_node) {
+                return nullptr;
+            }
+
+            __node *copy;
+
+            switch (_node->_M_type) {
+            case __leaf_type:
+                return new __leaf(*static_cast<const __leaf *>(_node));
+            case __node4_type:
+                copy = new __node4(*static_cast<const __node4 *>(_node));
+                break;
+            case __node16_type:
+                copy = new __node16(*static_cast<const __node16 *>(_node));
+                break;
+            case __node48_type:
+                copy = new __node48(*static_cast<const __node48 *>(_node));
+                break;
+            default:
+                copy = new __node256(*static_cast<const __node256 *>(_node));
+                break;
+            }
+
+            __inner *inner = static_cast<__inner *>(copy);
+            if (inner->_M_value_leaf) {
+                inner->_M_value_leaf = new __leaf(*inner->_M_value_leaf);
+            }
+            __children(inner, [](__node *&_child) {
+                _child = __clone(_child);
+            });
+
+            return copy;
+        }
+
+        static void __delete(__node *_node) {
+            switch (_node->_M_type) {
+            case __leaf_type:
+                delete static_cast<__leaf *>(_node);
+                break;
+            case __node4_type:
+                delete static_cast<__node4 *>(_node);
+                break;
+            case __node16_type:
+                delete static_cast<__node16 *>(_node);
+                break;
+            case __node48_type:
+                delete static_cast<__node48 *>(_node);
+                break;
+            default:
+                delete static_cast<__node256 *>(_node);
+                break;
+            }
+        }
+
+        static void __free(__node *_node) {
+            if (_node->_M_type != __leaf_type) {
+                __inner *inner = static_cast<__inner *>(_node);
+                if (inner->_M_value_leaf) {
+                    delete inner->_M_value_leaf;
+                }
+                __children(inner, [](__node *&_child) {
+                    __free(_child);
+                });
+            }
+
+            __delete(_node);
+        }
+
+        __node *_M_root = nullptr;          // The root, or nullptr when empty
+        size_type _M_size = 0;              // The number of entries
+    };
+}
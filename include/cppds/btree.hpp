@@ -0,0 +1,841 @@
+/**
+ * @file btree.hpp
+ * @brief The B+tree shared by btree_map and btree_set.
+ */
+
+#pragma once
+
+#include <algorithm>            ///< For std::lower_bound
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <iterator>             ///< For std::bidirectional_iterator_tag
+#include <memory>               ///< For std::allocator_traits
+#include <type_traits>          ///< For std::conditional_t and std::is_void
+#include <utility>              ///< For std::move, std::forward and std::swap
+
+#include "simd.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief The mapped values of a leaf, or nothing for sets.
+     */
+    template <typename _vTp, std::size_t _Nm>
+    struct __btree_values {
+        _vTp _M_values[_Nm];
+    };
+
+    template <std::size_t _Nm>
+    struct __btree_values<void, _Nm> {};
+
+    template <typename _Tp>
+    struct __btree_sizeof : std::integral_constant<std::size_t, sizeof(_Tp)> {};
+
+    template <>
+    struct __btree_sizeof<void> : std::integral_constant<std::size_t, 0> {};
+
+    /**
+     * @brief A B+tree with wide nodes and linked leaves.
+     *
+     * Nodes span several cache lines. Leaves keep their keys and values in
+     * separate arrays and are linked in key order, so range scans walk
+     * contiguous keys without returning to the inner nodes. Inner nodes keep
+     * as separator the largest key of each child but the last, and the
+     * position in a node is a lower bound, found by comparing against every
+     * key with cppds::__count_less for arithmetic keys under std::less.
+     *
+     * Erasure never merges or rebalances: it leaves nodes underfull and only
+     * frees nodes that become empty, which keeps it cheap and iterators to
+     * other leaves valid.
+     *
+     * @tparam _kTp The type of keys; default constructible and move assignable.
+     * @tparam _vTp The type of mapped values, or void for a set.
+     * @tparam _Compare The strict weak ordering of the keys.
+     * @tparam _Alloc The allocator, rebound to allocate the nodes.
+     */
+    template <typename _kTp, typename _vTp, typename _Compare, typename _Alloc>
+    class __btree {
+    public:
+        using key_type = _kTp;              ///< The type of keys.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+        using key_compare = _Compare;       ///< The ordering of the keys.
+        using allocator_type = _Alloc;      ///< The allocator type.
+
+    protected:
+        static constexpr size_type __node_bytes = 512;
+
+        /// Keys (and values) per leaf.
+        static constexpr size_type __leaf_slots =
+            std::max<size_type>(8, __node_bytes / (sizeof(_kTp) + __btree_sizeof<_vTp>::value));
+
+        /// Keys per inner node; it has one child more.
+        static constexpr size_type __inner_slots =
+            std::max<size_type>(8, __node_bytes / (sizeof(_kTp) + sizeof(void *)));
+
+        /// A bound on the height: a level only grows after __inner_slots / 2 splits of the one below.
+        static constexpr size_type __max_height = 64;
+
+        static constexpr bool __simd_search =
+            std::is_same<_Compare, std::less<_kTp>>::value && std::is_arithmetic<_kTp>::value;
+
+        struct __node {
+            size_type _M_count = 0;         // The number of keys
+            bool _M_leaf = false;           // Whether the node is a leaf
+        };
+
+        struct __leaf : __node {
+            _kTp _M_keys[__leaf_slots] {};
+            __btree_values<_vTp, __leaf_slots> _M_vals {};
+            __leaf *_M_prev = nullptr;
+            __leaf *_M_next = nullptr;
+
+            __leaf() {
+                this->_M_leaf = true;
+            }
+        };
+
+        struct __inner : __node {
+            _kTp _M_keys[__inner_slots] {};
+            __node *_M_children[__inner_slots + 1] {};
+        };
+
+        using __traits = std::allocator_traits<_Alloc>;
+        using __leaf_alloc = typename __traits::template rebind_alloc<__leaf>;
+        using __inner_alloc = typename __traits::template rebind_alloc<__inner>;
+        using __leaf_traits = std::allocator_traits<__leaf_alloc>;
+        using __inner_traits = std::allocator_traits<__inner_alloc>;
+
+        /**
+         * @brief An iterator over the entries in key order.
+         *
+         * Dereferencing yields the key; value() yields the mapped value of
+         * maps. Erasing an entry invalidates iterators into its leaf only.
+         */
+        template <bool _Const>
+        class __iterator {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = _kTp;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const _kTp *;
+            using reference = const _kTp &;
+            using mapped_reference = std::add_lvalue_reference_t<
+                std::conditional_t<_Const, std::add_const_t<_vTp>, _vTp>>;
+
+            __iterator() = default;
+
+            __iterator(__leaf *_leaf, size_type _index, const __btree *_tree)
+                : _M_leaf(_leaf), _M_index(_index), _M_tree(_tree) {}
+
+            /**
+             * @brief Convert a mutable iterator to a const one.
+             */
+            template <bool _Other, typename = std::enable_if_t<_Const && !_Other>>
+            __iterator(const __iterator<_Other> &_other)
+                : _M_leaf(_other._M_leaf), _M_index(_other._M_index), _M_tree(_other._M_tree) {}
+
+            reference operator*() const {
+                return this->_M_leaf->_M_keys[this->_M_index];
+            }
+
+            pointer operator->() const {
+                return &this->_M_leaf->_M_keys[this->_M_index];
+            }
+
+            /**
+             * @brief Access the key of the entry.
+             *
+             * @return A const reference to the key.
+             */
+            reference key() const {
+                return this->_M_leaf->_M_keys[this->_M_index];
+            }
+
+            /**
+             * @brief Access the mapped value of the entry.
+             *
+             * @return A reference to the value.
+             */
+            mapped_reference value() const {
+                return this->_M_leaf->_M_vals._M_values[this->_M_index];
+            }
+
+            __iterator &operator++() {
+                if (++this->_M_index == this->_M_leaf->_M_count) {
+                    this->_M_leaf = this->_M_leaf->_M_next;
+                    this->_M_index = 0;
+                }
+                return *this;
+            }
+
+            __iterator operator++(int) {
+                __iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            __iterator &operator--() {
+                if (!this->_M_leaf) {
+                    this->_M_leaf = this->_M_tree->_M_last;
+                    this->_M_index = this->_M_leaf->_M_count;
+                } else if (this->_M_index == 0) {
+                    this->_M_leaf = this->_M_leaf->_M_prev;
+                    this->_M_index = this->_M_leaf->_M_count;
+                }
+                --this->_M_index;
+                return *this;
+            }
+
+            __iterator operator--(int) {
+                __iterator old = *this;
+                --*this;
+                return old;
+            }
+
+            bool operator==(const __iterator &_other) const {
+                return this->_M_leaf == _other._M_leaf && this->_M_index == _other._M_index;
+            }
+
+            bool operator!=(const __iterator &_other) const {
+                return !(*this == _other);
+            }
+
+        protected:
+            friend class __btree;
+            template <bool> friend class __iterator;
+
+            __leaf *_M_leaf = nullptr;              // The leaf, or nullptr past the end
+            size_type _M_index = 0;                 // The slot in the leaf
+            const __btree *_M_tree = nullptr;       // The tree, to step back from the end
+        };
+
+    public:
+        using iterator = __iterator<false>;         ///< The iterator type.
+        using const_iterator = __iterator<true>;    ///< The constant iterator type.
+
+        /**
+         * @brief Constructor with an allocator.
+         *
+         * @param _alloc The allocator of the nodes.
+         */
+        explicit __btree(const _Alloc &_alloc = _Alloc()) : _M_alloc(_alloc) {}
+
+        /**
+         * @brief Copy constructor. Bulk loads a copy of the entries.
+         */
+        __btree(const __btree &_other)
+            : _M_compare(_other._M_compare),
+              _M_alloc(__traits::select_on_container_copy_construction(_other._M_alloc)) {
+            __copy_from(_other);
+        }
+
+        /**
+         * @brief Move constructor.
+         */
+        __btree(__btree &&_other) noexcept
+            : _M_compare(std::move(_other._M_compare)), _M_alloc(std::move(_other._M_alloc)) {
+            __steal(_other);
+        }
+
+        __btree &operator=(const __btree &_other) {
+            if (this != &_other) {
+                this->clear();
+                this->_M_compare = _other._M_compare;
+                __copy_from(_other);
+            }
+            return *this;
+        }
+
+        __btree &operator=(__btree &&_other) noexcept {
+            if (this != &_other) {
+                this->clear();
+                this->_M_compare = std::move(_other._M_compare);
+                this->_M_alloc = std::move(_other._M_alloc);
+                __steal(_other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destructor. Frees every node.
+         */
+        ~__btree() {
+            this->clear();
+        }
+
+        /**
+         * @brief Check if a key exists in the tree.
+         *
+         * @param _key The key to check for.
+         * @return `true` if the key exists, `false` otherwise.
+         */
+        bool contains(const key_type &_key) const {
+            if (!this->_M_root) {
+                return false;
+            }
+
+            const __leaf *leaf = __find_leaf(_key);
+            size_type idx = __lower(leaf->_M_keys, leaf->_M_count, _key);
+
+            return idx < leaf->_M_count && !_M_compare(_key, leaf->_M_keys[idx]);
+        }
+
+        /**
+         * @brief Find a key.
+         *
+         * @param _key The key to find.
+         * @return An iterator to the entry, or end() if the key is absent.
+         */
+        iterator find(const key_type &_key) {
+            iterator it = this->lower_bound(_key);
+            return it != this->end() && !_M_compare(_key, *it) ? it : this->end();
+        }
+
+        /**
+         * @brief Find a key (const version).
+         *
+         * @param _key The key to find.
+         * @return An iterator to the entry, or end() if the key is absent.
+         */
+        const_iterator find(const key_type &_key) const {
+            return const_cast<__btree *>(this)->find(_key);
+        }
+
+        /**
+         * @brief Find the first entry whose key is not less than a key.
+         *
+         * @param _key The key to compare against.
+         * @return An iterator to the entry, or end() if there is none.
+         */
+        iterator lower_bound(const key_type &_key) {
+            if (!this->_M_root) {
+                return this->end();
+            }
+
+            __leaf *leaf = __find_leaf(_key);
+            size_type idx = __lower(leaf->_M_keys, leaf->_M_count, _key);
+
+            // The separators bound the leaf from above, so the next leaf starts past _key.
+            if (idx == leaf->_M_count) {
+                return iterator(leaf->_M_next, 0, this);
+            }
+
+            return iterator(leaf, idx, this);
+        }
+
+        /**
+         * @brief Find the first entry whose key is not less than a key (const version).
+         */
+        const_iterator lower_bound(const key_type &_key) const {
+            return const_cast<__btree *>(this)->lower_bound(_key);
+        }
+
+        /**
+         * @brief Find the first entry whose key is greater than a key.
+         *
+         * @param _key The key to compare against.
+         * @return An iterator to the entry, or end() if there is none.
+         */
+        iterator upper_bound(const key_type &_key) {
+            iterator it = this->lower_bound(_key);
+            if (it != this->end() && !_M_compare(_key, *it)) {
+                ++it;
+            }
+            return it;
+        }
+
+        /**
+         * @brief Find the first entry whose key is greater than a key (const version).
+         */
+        const_iterator upper_bound(const key_type &_key) const {
+            return const_cast<__btree *>(this)->upper_bound(_key);
+        }
+
+        /**
+         * @brief Erase a key and its value.
+         *
+         * @param _key The key to erase.
+         * @return `true` if the key was erased, `false` if it was absent.
+         */
+        bool erase(const key_type &_key) {
+            if (!this->_M_root) {
+                return false;
+            }
+
+            __inner *parents[__max_height];
+            size_type slots[__max_height];
+            size_type depth = 0;
+
+            __leaf *leaf = __find_leaf(_key, parents, slots, depth);
+            size_type idx = __lower(leaf->_M_keys, leaf->_M_count, _key);
+
+            if (idx == leaf->_M_count || _M_compare(_key, leaf->_M_keys[idx])) {
+                return false;
+            }
+
+            for (size_type i = idx + 1; i < leaf->_M_count; ++i) {
+                __move_slot(leaf, i - 1, leaf, i);
+            }
+            --leaf->_M_count;
+            --this->_M_size;
+
+            if (leaf->_M_count == 0) {
+                __remove_leaf(leaf, parents, slots, depth);
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Remove every entry and free every node.
+         */
+        void clear() {
+            if (this->_M_root) {
+                __free(this->_M_root);
+            }
+
+            this->_M_root = nullptr;
+            this->_M_first = nullptr;
+            this->_M_last = nullptr;
+            this->_M_size = 0;
+        }
+
+        /**
+         * @brief Swap the contents with another tree.
+         *
+         * @param _other The tree to swap with.
+         */
+        void swap(__btree &_other) noexcept {
+            std::swap(this->_M_compare, _other._M_compare);
+            std::swap(this->_M_alloc, _other._M_alloc);
+            std::swap(this->_M_root, _other._M_root);
+            std::swap(this->_M_first, _other._M_first);
+            std::swap(this->_M_last, _other._M_last);
+            std::swap(this->_M_size, _other._M_size);
+        }
+
+        /**
+         * @brief Get the number of entries.
+         *
+         * @return The number of entries in the tree.
+         */
+        size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Check if the tree is empty.
+         *
+         * @return `true` if the tree is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_size == 0;
+        }
+
+        /**
+         * @brief Get a copy of the allocator.
+         *
+         * @return The allocator.
+         */
+        allocator_type get_allocator() const {
+            return this->_M_alloc;
+        }
+
+        iterator begin() {
+            return iterator(this->_M_first, 0, this);
+        }
+
+        iterator end() {
+            return iterator(nullptr, 0, this);
+        }
+
+        const_iterator begin() const {
+            return const_iterator(this->_M_first, 0, this);
+        }
+
+        const_iterator end() const {
+            return const_iterator(nullptr, 0, this);
+        }
+
+    protected:
+        /**
+         * @brief Visit the entries with keys in [_low, _high) leaf by leaf.
+         *
+         * @param _func Called with the leaf and the slot of each entry.
+         */
+        template <typename _Func>
+        void __scan(const key_type &_low, const key_type &_high, _Func &_func) const {
+            const_iterator it = this->lower_bound(_low);
+            size_type i = it._M_index;
+
+            for (__leaf *leaf = it._M_leaf; leaf; leaf = leaf->_M_next, i = 0) {
+                size_type end = __lower(leaf->_M_keys, leaf->_M_count, _high);
+
+                for (; i < end; ++i) {
+                    _func(leaf, i);
+                }
+
+                if (end < leaf->_M_count) {
+                    return;
+                }
+            }
+        }
+
+        size_type __lower(const _kTp *_keys, size_type _count, const key_type &_key) const {
+            if constexpr (__simd_search) {
+                return __count_less(_keys, _count, _key);
+            } else {
+                return std::lower_bound(_keys, _keys + _count, _key, _M_compare) - _keys;
+            }
+        }
+
+        __leaf *__find_leaf(const key_type &_key) const {
+            __node *node = this->_M_root;
+
+            while (!node->_M_leaf) {
+                __inner *inner = static_cast<__inner *>(node);
+                node = inner->_M_children[__lower(inner->_M_keys, inner->_M_count, _key)];
+            }
+
+            return static_cast<__leaf *>(node);
+        }
+
+        /**
+         * @brief Descend to the leaf of a key, recording the inner nodes and the children taken.
+         */
+        __leaf *__find_leaf(const key_type &_key, __inner **_parents, size_type *_slots, size_type &_depth) const {
+            __node *node = this->_M_root;
+
+            while (!node->_M_leaf) {
+                __inner *inner = static_cast<__inner *>(node);
+                size_type slot = __lower(inner->_M_keys, inner->_M_count, _key);
+
+                _parents[_depth] = inner;
+                _slots[_depth++] = slot;
+
+                node = inner->_M_children[slot];
+            }
+
+            return static_cast<__leaf *>(node);
+        }
+
+        static void __move_slot(__leaf *_dst, size_type _di, __leaf *_src, size_type _si) {
+            _dst->_M_keys[_di] = std::move(_src->_M_keys[_si]);
+            if constexpr (!std::is_void<_vTp>::value) {
+                _dst->_M_vals._M_values[_di] = std::move(_src->_M_vals._M_values[_si]);
+            }
+        }
+
+        /**
+         * @brief Find the slot of a key, inserting the key if it is absent.
+         *
+         * The value in a new slot is unspecified; the caller assigns it.
+         *
+         * @param _key The key.
+         * @param _inserted Set to whether the key was inserted.
+         * @return The position of the key.
+         */
+        iterator __insert_slot(const key_type &_key, bool &_inserted) {
+            if (!this->_M_root) {
+                __leaf *leaf = __new_leaf();
+                this->_M_root = leaf;
+                this->_M_first = leaf;
+                this->_M_last = leaf;
+            }
+
+            __inner *parents[__max_height];
+            size_type slots[__max_height];
+            size_type depth = 0;
+
+            __leaf *leaf = __find_leaf(_key, parents, slots, depth);
+            size_type idx = __lower(leaf->_M_keys, leaf->_M_count, _key);
+
+            if (idx < leaf->_M_count && !_M_compare(_key, leaf->_M_keys[idx])) {
+                _inserted = false;
+                return iterator(leaf, idx, this);
+            }
+
+            _inserted = true;
+            ++this->_M_size;
+
+            if (leaf->_M_count == __leaf_slots) {
+                // Appending to the last leaf splits off an empty one, so
+                // ascending insertions fill leaves completely.
+                size_type half = idx == __leaf_slots && !leaf->_M_next ? __leaf_slots : __leaf_slots / 2;
+
+                __leaf *right = __new_leaf();
+
+                for (size_type i = half; i < __leaf_slots; ++i) {
+                    __move_slot(right, i - half, leaf, i);
+                }
+                right->_M_count = __leaf_slots - half;
+                leaf->_M_count = half;
+
+                right->_M_next = leaf->_M_next;
+                right->_M_prev = leaf;
+                if (leaf->_M_next) {
+                    leaf->_M_next->_M_prev = right;
+                } else {
+                    this->_M_last = right;
+                }
+                leaf->_M_next = right;
+
+                __insert_child(parents, slots, depth, leaf->_M_keys[half - 1], right);
+
+                if (idx >= half) {
+                    leaf = right;
+                    idx -= half;
+                }
+            }
+
+            for (size_type i = leaf->_M_count; i > idx; --i) {
+                __move_slot(leaf, i, leaf, i - 1);
+            }
+            leaf->_M_keys[idx] = _key;
+            ++leaf->_M_count;
+
+            return iterator(leaf, idx, this);
+        }
+
+        /**
+         * @brief Insert a new right sibling and its separator into the parents, splitting them as needed.
+         */
+        void __insert_child(__inner **_parents, size_type *_slots, size_type _depth,
+                            key_type _separator, __node *_right) {
+            while (_depth > 0) {
+                __inner *parent = _parents[--_depth];
+                size_type slot = _slots[_depth];
+
+                if (parent->_M_count < __inner_slots) {
+                    for (size_type i = parent->_M_count; i > slot; --i) {
+                        parent->_M_keys[i] = std::move(parent->_M_keys[i - 1]);
+                        parent->_M_children[i + 1] = parent->_M_children[i];
+                    }
+                    parent->_M_keys[slot] = std::move(_separator);
+                    parent->_M_children[slot + 1] = _right;
+                    ++parent->_M_count;
+                    return;
+                }
+
+                // Split a full parent: merge the new child in, then halve.
+                key_type keys[__inner_slots + 1];
+                __node *children[__inner_slots + 2];
+
+                for (size_type i = 0, j = 0; i <= __inner_slots; ++i) {
+                    keys[i] = i == slot ? std::move(_separator) : std::move(parent->_M_keys[j++]);
+                }
+                for (size_type i = 0, j = 0; i <= __inner_slots + 1; ++i) {
+                    children[i] = i == slot + 1 ? _right : parent->_M_children[j++];
+                }
+
+                size_type half = (__inner_slots + 1) / 2;
+                __inner *sibling = __new_inner();
+
+                for (size_type i = 0; i < half; ++i) {
+                    parent->_M_keys[i] = std::move(keys[i]);
+                    parent->_M_children[i] = children[i];
+                }
+                parent->_M_children[half] = children[half];
+                parent->_M_count = half;
+
+                for (size_type i = half + 1; i <= __inner_slots; ++i) {
+                    sibling->_M_keys[i - half - 1] = std::move(keys[i]);
+                    sibling->_M_children[i - half - 1] = children[i];
+                }
+                sibling->_M_children[__inner_slots - half] = children[__inner_slots + 1];
+                sibling->_M_count = __inner_slots - half;
+
+                _separator = std::move(keys[half]);
+                _right = sibling;
+            }
+
+            __inner *root = __new_inner();
+            root->_M_keys[0] = std::move(_separator);
+            root->_M_children[0] = this->_M_root;
+            root->_M_children[1] = _right;
+            root->_M_count = 1;
+            this->_M_root = root;
+        }
+
+        /**
+         * @brief Unlink and free an empty leaf, then free the inner nodes left without children.
+         */
+        void __remove_leaf(__leaf *_leaf, __inner **_parents, size_type *_slots, size_type _depth) {
+            if (_leaf->_M_prev) {
+                _leaf->_M_prev->_M_next = _leaf->_M_next;
+            } else {
+                this->_M_first = _leaf->_M_next;
+            }
+            if (_leaf->_M_next) {
+                _leaf->_M_next->_M_prev = _leaf->_M_prev;
+            } else {
+                this->_M_last = _leaf->_M_prev;
+            }
+
+            __delete_leaf(_leaf);
+
+            while (_depth > 0) {
+                __inner *parent = _parents[--_depth];
+                size_type slot = _slots[_depth];
+
+                if (parent->_M_count > 0) {
+                    // Drop the child and the separator on the side that keeps the ranges covered.
+                    for (size_type i = slot < parent->_M_count ? slot : slot - 1; i + 1 < parent->_M_count; ++i) {
+                        parent->_M_keys[i] = std::move(parent->_M_keys[i + 1]);
+                    }
+                    for (size_type i = slot; i < parent->_M_count; ++i) {
+                        parent->_M_children[i] = parent->_M_children[i + 1];
+                    }
+                    --parent->_M_count;
+
+                    // Collapse roots left with a single child.
+                    while (!this->_M_root->_M_leaf && this->_M_root->_M_count == 0) {
+                        __inner *root = static_cast<__inner *>(this->_M_root);
+                        this->_M_root = root->_M_children[0];
+                        __delete_inner(root);
+                    }
+                    return;
+                }
+
+                __delete_inner(parent);
+            }
+
+            this->_M_root = nullptr;
+        }
+
+        /**
+         * @brief Replace the contents with strictly ascending entries, filling every node.
+         *
+         * @param _first The beginning of the entries.
+         * @param _last The end of the entries.
+         * @param _assign Stores the entry at an iterator into a leaf slot.
+         */
+        template <typename _InputIt, typename _Assign>
+        void __bulk_load(_InputIt _first, _InputIt _last, _Assign _assign) {
+            this->clear();
+
+            vector<__node *> level;
+            vector<key_type> maxima;
+            __leaf *leaf = nullptr;
+
+            for (; _first != _last; ++_first) {
+                if (!leaf || leaf->_M_count == __leaf_slots) {
+                    __leaf *next = __new_leaf();
+                    if (leaf) {
+                        leaf->_M_next = next;
+                        next->_M_prev = leaf;
+                        maxima.push_back(leaf->_M_keys[leaf->_M_count - 1]);
+                    } else {
+                        this->_M_first = next;
+                    }
+                    leaf = next;
+                    level.push_back(leaf);
+                }
+
+                _assign(leaf, leaf->_M_count++, _first);
+                ++this->_M_size;
+            }
+
+            if (!leaf) {
+                return;
+            }
+
+            maxima.push_back(leaf->_M_keys[leaf->_M_count - 1]);
+            this->_M_last = leaf;
+
+            while (level.size() > 1) {
+                vector<__node *> parents;
+                vector<key_type> parent_maxima;
+
+                for (size_type i = 0; i < level.size(); i += __inner_slots + 1) {
+                    size_type end = std::min(level.size(), i + __inner_slots + 1);
+                    __inner *inner = __new_inner();
+
+                    for (size_type j = i; j < end; ++j) {
+                        inner->_M_children[j - i] = level[j];
+                        if (j + 1 < end) {
+                            inner->_M_keys[j - i] = maxima[j];
+                        }
+                    }
+                    inner->_M_count = end - i - 1;
+
+                    parents.push_back(inner);
+                    parent_maxima.push_back(maxima[end - 1]);
+                }
+
+                level = std::move(parents);
+                maxima = std::move(parent_maxima);
+            }
+
+            this->_M_root = level[0];
+        }
+
+        void __copy_from(const __btree &_other) {
+            __bulk_load(_other.begin(), _other.end(), [](__leaf *_leaf, size_type _index, const_iterator _it) {
+                _leaf->_M_keys[_index] = _it.key();
+                if constexpr (!std::is_void<_vTp>::value) {
+                    _leaf->_M_vals._M_values[_index] = _it.value();
+                }
+            });
+        }
+
+        void __steal(__btree &_other) {
+            this->_M_root = _other._M_root;
+            this->_M_first = _other._M_first;
+            this->_M_last = _other._M_last;
+            this->_M_size = _other._M_size;
+
+            _other._M_root = nullptr;
+            _other._M_first = nullptr;
+            _other._M_last = nullptr;
+            _other._M_size = 0;
+        }
+
+        __leaf *__new_leaf() {
+            __leaf_alloc alloc(this->_M_alloc);
+            __leaf *leaf = __leaf_traits::allocate(alloc, 1);
+            __leaf_traits::construct(alloc, leaf);
+            return leaf;
+        }
+
+        __inner *__new_inner() {
+            __inner_alloc alloc(this->_M_alloc);
+            __inner *inner = __inner_traits::allocate(alloc, 1);
+            __inner_traits::construct(alloc, inner);
+            return inner;
+        }
+
+        void __delete_leaf(__leaf *_leaf) {
+            __leaf_alloc alloc(this->_M_alloc);
+            __leaf_traits::destroy(alloc, _leaf);
+            __leaf_traits::deallocate(alloc, _leaf, 1);
+        }
+
+        void __delete_inner(__inner *_inner) {
+            __inner_alloc alloc(this->_M_alloc);
+            __inner_traits::destroy(alloc, _inner);
+            __inner_traits::deallocate(alloc, _inner, 1);
+        }
+
+        void __free(__node *_node) {
+            if (_node->_M_leaf) {
+                __delete_leaf(static_cast<__leaf *>(_node));
+                return;
+            }
+
+            __inner *inner = static_cast<__inner *>(_node);
+            for (size_type i = 0; i <= inner->_M_count; ++i) {
+                __free(inner->_M_children[i]);
+            }
+            __delete_inner(inner);
+        }
+
+        _Compare _M_compare {};             // The ordering of the keys
+        _Alloc _M_alloc {};                 // The allocator of the nodes
+        __node *_M_root = nullptr;          // The root, or nullptr when empty
+        __leaf *_M_first = nullptr;         // The leftmost leaf
+        __leaf *_M_last = nullptr;          // The rightmost leaf
+        size_type _M_size = 0;              // The number of entries
+    };
+}
@@ -0,0 +1,201 @@
+/**
+ * @file btree_map.hpp
+ * @brief An ordered map stored in a cache-friendly B+tree.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <initializer_list>     ///< For std::initializer_list
+#include <memory>               ///< For std::allocator
+#include <stdexcept>            ///< For std::out_of_range exception
+
+#include "btree.hpp"
+#include "pair.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief An ordered map stored in a B+tree.
+     *
+     * Keys and values live in wide leaves linked in key order, so lookups
+     * touch a few cache lines per level and range scans read contiguous keys.
+     * Iterators dereference to the key; use value() for the mapped value.
+     * Building from sorted input with bulk_load() fills every node.
+     *
+     * @tparam _kTp The type of keys in the map.
+     * @tparam _vTp The type of values in the map.
+     * @tparam _Compare The strict weak ordering of the keys.
+     * @tparam _Alloc The allocator, rebound to allocate the nodes.
+     */
+    template <typename _kTp, typename _vTp, typename _Compare = std::less<_kTp>,
+              typename _Alloc = std::allocator<cppds::pair<_kTp, _vTp>>>
+    class btree_map : public __btree<_kTp, _vTp, _Compare, _Alloc> {
+    protected:
+        using __base = __btree<_kTp, _vTp, _Compare, _Alloc>;
+        using __pair_type = cppds::pair<_kTp, _vTp>;
+        using typename __base::__leaf;
+
+    public:
+        using key_type = _kTp;              ///< The type of keys in the map.
+        using value_type = _vTp;            ///< The type of values in the map.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+        using typename __base::iterator;
+        using typename __base::const_iterator;
+
+        /**
+         * @brief Default constructor.
+         */
+        btree_map() = default;
+
+        /**
+         * @brief Constructor with an allocator.
+         *
+         * @param _alloc The allocator of the nodes.
+         */
+        explicit btree_map(const _Alloc &_alloc) : __base(_alloc) {}
+
+        /**
+         * @brief Constructor that inserts a range of key-value pairs.
+         *
+         * @param _first The beginning of the range of pairs.
+         * @param _last The end of the range of pairs.
+         */
+        template <typename _InputIt>
+        btree_map(_InputIt _first, _InputIt _last) {
+            this->insert(_first, _last);
+        }
+
+        /**
+         * @brief Constructor that inserts an initializer list of key-value pairs.
+         *
+         * @param _list An initializer list of key-value pairs.
+         */
+        btree_map(const std::initializer_list<__pair_type> &_list) {
+            operator=(_list);
+        }
+
+        /**
+         * @brief Assignment operator to assign key-value pairs from an initializer list.
+         *
+         * @param _list An initializer list of key-value pairs.
+         * @return A reference to the modified map.
+         */
+        btree_map &operator=(const std::initializer_list<__pair_type> &_list) {
+            this->clear();
+            this->insert(_list.begin(), _list.end());
+            return *this;
+        }
+
+        /**
+         * @brief Insert a key-value pair, replacing the value of an existing key.
+         *
+         * @param _key The key to insert.
+         * @param _value The corresponding value to insert.
+         * @return `true` if the key was new, `false` if its value was replaced.
+         */
+        bool insert(const key_type &_key, const value_type &_value) {
+            bool inserted;
+            this->__insert_slot(_key, inserted).value() = _value;
+            return inserted;
+        }
+
+        /**
+         * @brief Insert a range of key-value pairs.
+         *
+         * @param _first The beginning of the range of pairs.
+         * @param _last The end of the range of pairs.
+         */
+        template <typename _InputIt>
+        void insert(_InputIt _first, _InputIt _last) {
+            for (; _first != _last; ++_first) {
+                this->insert((*_first).first, (*_first).second);
+            }
+        }
+
+        /**
+         * @brief Replace the contents with key-value pairs sorted by strictly ascending key.
+         *
+         * Builds the tree bottom-up with full nodes in linear time.
+         *
+         * @param _first The beginning of the sorted range of pairs.
+         * @param _last The end of the sorted range of pairs.
+         */
+        template <typename _InputIt>
+        void bulk_load(_InputIt _first, _InputIt _last) {
+            this->__bulk_load(_first, _last, [](__leaf *_leaf, size_type _index, const _InputIt &_it) {
+                _leaf->_M_keys[_index] = (*_it).first;
+                _leaf->_M_vals._M_values[_index] = (*_it).second;
+            });
+        }
+
+        /**
+         * @brief Access the value of a key, inserting a value-initialized one if it is absent.
+         *
+         * @param _key The key to look up.
+         * @return A reference to the value.
+         */
+        value_type &operator[](const key_type &_key) {
+            bool inserted;
+            iterator it = this->__insert_slot(_key, inserted);
+
+            if (inserted) {
+                it.value() = value_type();
+            }
+
+            return it.value();
+        }
+
+        /**
+         * @brief Access the value of a key.
+         *
+         * @param _key The key to look up.
+         * @return A reference to the value.
+         * @throw std::out_of_range if the key is absent.
+         */
+        value_type &at(const key_type &_key) {
+            iterator it = this->find(_key);
+
+            if (it == this->end()) {
+                throw std::out_of_range("key not found");
+            }
+
+            return it.value();
+        }
+
+        /**
+         * @brief Access the value of a key (const version).
+         *
+         * @param _key The key to look up.
+         * @return A const reference to the value.
+         * @throw std::out_of_range if the key is absent.
+         */
+        const value_type &at(const key_type &_key) const {
+            const_iterator it = this->find(_key);
+
+            if (it == this->end()) {
+                throw std::out_of_range("key not found");
+            }
+
+            return it.value();
+        }
+
+        /**
+         * @brief Visit the entries with keys in the half-open range [_low, _high) in order.
+         *
+         * Walks the leaves directly, which is faster than iterating.
+         *
+         * @param _low The smallest key in the range.
+         * @param _high The key past the range.
+         * @param _func Called as `_func(key, value)` for each entry.
+         */
+        template <typename _Func>
+        void for_each(const key_type &_low, const key_type &_high, _Func _func) const {
+            auto visit = [&_func](const __leaf *_leaf, size_type _index) {
+                _func(_leaf->_M_keys[_index], _leaf->_M_vals._M_values[_index]);
+            };
+            this->__scan(_low, _high, visit);
+        }
+    };
+}
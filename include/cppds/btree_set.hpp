@@ -0,0 +1,142 @@
+/**
+ * @file btree_set.hpp
+ * @brief An ordered set stored in a cache-friendly B+tree.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <initializer_list>     ///< For std::initializer_list
+#include <memory>               ///< For std::allocator
+
+#include "btree.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief An ordered set stored in a B+tree.
+     *
+     * Elements live in wide leaves linked in order, so lookups touch a few
+     * cache lines per level and range scans read contiguous elements.
+     * Building from sorted input with bulk_load() fills every node.
+     *
+     * @tparam _Tp The type of elements stored in the set.
+     * @tparam _Compare The strict weak ordering of the elements.
+     * @tparam _Alloc The allocator, rebound to allocate the nodes.
+     */
+    template <typename _Tp, typename _Compare = std::less<_Tp>, typename _Alloc = std::allocator<_Tp>>
+    class btree_set : public __btree<_Tp, void, _Compare, _Alloc> {
+    protected:
+        using __base = __btree<_Tp, void, _Compare, _Alloc>;
+        using typename __base::__leaf;
+
+    public:
+        using key_type = _Tp;               ///< The type of elements stored in the set.
+        using value_type = _Tp;             ///< The type of elements stored in the set.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+        using typename __base::iterator;
+        using typename __base::const_iterator;
+
+        /**
+         * @brief Default constructor.
+         */
+        btree_set() = default;
+
+        /**
+         * @brief Constructor with an allocator.
+         *
+         * @param _alloc The allocator of the nodes.
+         */
+        explicit btree_set(const _Alloc &_alloc) : __base(_alloc) {}
+
+        /**
+         * @brief Constructor that inserts a range of values.
+         *
+         * @param _first The beginning of the range of values.
+         * @param _last The end of the range of values.
+         */
+        template <typename _InputIt>
+        btree_set(_InputIt _first, _InputIt _last) {
+            this->insert(_first, _last);
+        }
+
+        /**
+         * @brief Constructor that inserts an initializer list of values.
+         *
+         * @param _list An initializer list of values.
+         */
+        btree_set(const std::initializer_list<value_type> &_list) {
+            operator=(_list);
+        }
+
+        /**
+         * @brief Assignment operator to assign values from an initializer list.
+         *
+         * @param _list An initializer list of values.
+         * @return A reference to the modified set.
+         */
+        btree_set &operator=(const std::initializer_list<value_type> &_list) {
+            this->clear();
+            this->insert(_list.begin(), _list.end());
+            return *this;
+        }
+
+        /**
+         * @brief Insert a value into the set.
+         *
+         * @param _value The value to insert.
+         * @return `true` if the value was inserted, `false` if it was present.
+         */
+        bool insert(const value_type &_value) {
+            bool inserted;
+            this->__insert_slot(_value, inserted);
+            return inserted;
+        }
+
+        /**
+         * @brief Insert a range of values.
+         *
+         * @param _first The beginning of the range of values.
+         * @param _last The end of the range of values.
+         */
+        template <typename _InputIt>
+        void insert(_InputIt _first, _InputIt _last) {
+            for (; _first != _last; ++_first) {
+                this->insert(*_first);
+            }
+        }
+
+        /**
+         * @brief Replace the contents with strictly ascending values.
+         *
+         * Builds the tree bottom-up with full nodes in linear time.
+         *
+         * @param _first The beginning of the sorted range of values.
+         * @param _last The end of the sorted range of values.
+         */
+        template <typename _InputIt>
+        void bulk_load(_InputIt _first, _InputIt _last) {
+            this->__bulk_load(_first, _last, [](__leaf *_leaf, size_type _index, const _InputIt &_it) {
+                _leaf->_M_keys[_index] = *_it;
+            });
+        }
+
+        /**
+         * @brief Visit the elements in the half-open range [_low, _high) in order.
+         *
+         * Walks the leaves directly, which is faster than iterating.
+         *
+         * @param _low The smallest element in the range.
+         * @param _high The element past the range.
+         * @param _func Called as `_func(value)` for each element.
+         */
+        template <typename _Func>
+        void for_each(const value_type &_low, const value_type &_high, _Func _func) const {
+            auto visit = [&_func](const __leaf *_leaf, size_type _index) {
+                _func(_leaf->_M_keys[_index]);
+            };
+            this->__scan(_low, _high, visit);
+        }
+    };
+}
@@ -0,0 +1,450 @@
+/**
+ * @file concurrent_skiplist_map.hpp
+ * @brief An ordered map for concurrent insertion and lookup, stored in a lock-free skip list.
+ */
+
+#pragma once
+
+#include <atomic>               ///< For std::atomic
+#include <cstddef>              ///< For std::size_t and std::max_align_t
+#include <cstdint>              ///< For std::uint64_t and std::uintptr_t
+#include <functional>           ///< For std::less
+#include <iterator>             ///< For std::forward_iterator_tag
+#include <mutex>                ///< For std::mutex and std::lock_guard
+#include <new>                  ///< For placement new
+#include <thread>               ///< For std::this_thread::get_id
+#include <type_traits>          ///< For std::is_trivially_destructible
+
+namespace cppds {
+
+    /**
+     * @brief A bump allocator that several threads can allocate from at once.
+     *
+     * Memory comes from large blocks and is only released when the arena is
+     * destroyed. Allocation is a fetch_add on the current block; only the
+     * thread that exhausts a block takes a lock to chain a new one.
+     */
+    class __concurrent_arena {
+    public:
+        using size_type = std::size_t;
+
+        static constexpr size_type block_size = 1 << 20;     ///< The default block size in bytes.
+
+        __concurrent_arena() = default;
+
+        __concurrent_arena(const __concurrent_arena &) = delete;
+        __concurrent_arena &operator=(const __concurrent_arena &) = delete;
+
+        ~__concurrent_arena() {
+            __block *block = this->_M_current.load(std::memory_order_relaxed);
+
+            while (block) {
+                __block *prev = block->_M_prev;
+                ::operator delete(block);
+                block = prev;
+            }
+        }
+
+        /**
+         * @brief Allocate memory aligned for any fundamental type.
+         *
+         * @param _bytes The number of bytes.
+         * @return The memory; it lives until the arena is destroyed.
+         */
+        void *allocate(size_type _bytes) {
+            _bytes = (_bytes + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+            while (true) {
+                __block *block = this->_M_current.load(std::memory_order_acquire);
+
+                if (block) {
+                    size_type offset = block->_M_used.fetch_add(_bytes, std::memory_order_relaxed);
+                    if (offset + _bytes <= block->_M_size) {
+                        return block->__data() + offset;
+                    }
+                }
+
+                __grow(block, _bytes);
+            }
+        }
+
+        /**
+         * @brief Get the number of bytes reserved from the system.
+         *
+         * @return The total size of the blocks.
+         */
+        size_type memory_usage() const {
+            return this->_M_reserved.load(std::memory_order_relaxed);
+        }
+
+    protected:
+        struct alignas(std::max_align_t) __block {
+            __block *_M_prev;                       // The previously filled block
+            size_type _M_size;                      // The usable bytes
+            std::atomic<size_type> _M_used;         // The bytes handed out, possibly past _M_size
+
+            char *__data() {
+                return reinterpret_cast<char *>(this + 1);
+            }
+        };
+
+        /**
+         * @brief Chain a new block unless another thread already replaced _full.
+         */
+        void __grow(__block *_full, size_type _bytes) {
+            std::lock_guard<std::mutex> lock(this->_M_mutex);
+
+            if (this->_M_current.load(std::memory_order_relaxed) != _full) {
+                return;
+            }
+
+            size_type size = _bytes > block_size ? _bytes : block_size;
+            void *memory = ::operator new(sizeof(__block) + size);
+
+            __block *block = ::new (memory) __block {_full, size, {0}};
+            this->_M_reserved.fetch_add(sizeof(__block) + size, std::memory_order_relaxed);
+            this->_M_current.store(block, std::memory_order_release);
+        }
+
+        std::atomic<__block *> _M_current {nullptr};       // The block being allocated from
+        std::atomic<size_type> _M_reserved {0};             // The total size of the blocks
+        std::mutex _M_mutex;                                // Serializes chaining new blocks
+    };
+
+    /**
+     * @brief An ordered map for concurrent insertion and lookup.
+     *
+     * A skip list whose nodes are linked with compare-and-swap, so any number
+     * of threads may insert and read at the same time without locks. Lookups
+     * and iteration never retry or wait, and iterators stay valid while
+     * other threads insert; entries inserted during an iteration may or may
+     * not be visited. Nodes come from an arena and are freed together when
+     * the map is destroyed, which makes the map a good fit for write-heavy
+     * memtables that are flushed and dropped as a whole.
+     *
+     * Entries cannot be erased and an inserted value is never modified, so
+     * values can be read without synchronization.
+     *
+     * @tparam _kTp The type of keys in the map.
+     * @tparam _vTp The type of values in the map.
+     * @tparam _Compare The strict weak ordering of the keys.
+     */
+    template <typename _kTp, typename _vTp, typename _Compare = std::less<_kTp>>
+    class concurrent_skiplist_map {
+    public:
+        using key_type = _kTp;              ///< The type of keys in the map.
+        using value_type = _vTp;            ///< The type of values in the map.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /// The number of levels; with a branching factor of 4 this suits up to 4^16 entries.
+        static constexpr int max_height = 16;
+
+    protected:
+        struct __node {
+            _kTp _M_key;
+            _vTp _M_value;
+            int _M_height;
+            std::atomic<__node *> _M_next[1];       // _M_height links, allocated past the end
+
+            __node(const _kTp &_key, const _vTp &_value, int _height)
+                : _M_key(_key), _M_value(_value), _M_height(_height) {
+                for (int i = 0; i < _height; ++i) {
+                    ::new (&this->_M_next[i]) std::atomic<__node *>(nullptr);
+                }
+            }
+
+            __node *__next(int _level) const {
+                return this->_M_next[_level].load(std::memory_order_acquire);
+            }
+        };
+
+    public:
+        /**
+         * @brief A forward iterator over the entries in key order.
+         *
+         * Dereferencing yields the key; value() yields the value.
+         */
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = _kTp;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const _kTp *;
+            using reference = const _kTp &;
+
+            const_iterator() = default;
+
+            explicit const_iterator(const __node *_node) : _M_node(_node) {}
+
+            reference operator*() const {
+                return this->_M_node->_M_key;
+            }
+
+            pointer operator->() const {
+                return &this->_M_node->_M_key;
+            }
+
+            /**
+             * @brief Access the key of the entry.
+             *
+             * @return A const reference to the key.
+             */
+            reference key() const {
+                return this->_M_node->_M_key;
+            }
+
+            /**
+             * @brief Access the value of the entry.
+             *
+             * @return A const reference to the value.
+             */
+            const _vTp &value() const {
+                return this->_M_node->_M_value;
+            }
+
+            const_iterator &operator++() {
+                this->_M_node = this->_M_node->__next(0);
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            bool operator==(const const_iterator &_other) const {
+                return this->_M_node == _other._M_node;
+            }
+
+            bool operator!=(const const_iterator &_other) const {
+                return this->_M_node != _other._M_node;
+            }
+
+        protected:
+            const __node *_M_node = nullptr;        // The node, or nullptr past the end
+        };
+
+        using iterator = const_iterator;            ///< Entries are immutable once inserted.
+
+        /**
+         * @brief Default constructor.
+         */
+        concurrent_skiplist_map() : _M_head(__new_node(_kTp(), _vTp(), max_height)) {}
+
+        concurrent_skiplist_map(const concurrent_skiplist_map &) = delete;
+        concurrent_skiplist_map &operator=(const concurrent_skiplist_map &) = delete;
+
+        /**
+         * @brief Destructor. Destroys the entries and releases the arena.
+         *
+         * No other thread may use the map at this point.
+         */
+        ~concurrent_skiplist_map() {
+            if constexpr (!std::is_trivially_destructible<__node>::value) {
+                __node *node = this->_M_head;
+
+                while (node) {
+                    __node *next = node->__next(0);
+                    node->~__node();
+                    node = next;
+                }
+            }
+        }
+
+        /**
+         * @brief Insert a key-value pair if the key is absent. Thread-safe.
+         *
+         * @param _key The key to insert.
+         * @param _value The corresponding value to insert.
+         * @return `true` if the pair was inserted, `false` if the key was present.
+         */
+        bool insert(const key_type &_key, const value_type &_value) {
+            __node *preds[max_height];
+            __node *succs[max_height];
+
+            if (__find(_key, preds, succs)) {
+                return false;
+            }
+
+            int height = __random_height();
+            __node *node = __new_node(_key, _value, height);
+
+            // Publishing at level 0 makes the entry visible; a failed CAS means
+            // a neighbour changed, so search again from the top.
+            while (true) {
+                node->_M_next[0].store(succs[0], std::memory_order_relaxed);
+
+                if (preds[0]->_M_next[0].compare_exchange_strong(succs[0], node,
+                        std::memory_order_release, std::memory_order_relaxed)) {
+                    break;
+                }
+
+                if (__find(_key, preds, succs)) {
+                    // Lost a race with an insertion of the same key; the arena keeps the memory.
+                    node->~__node();
+                    return false;
+                }
+            }
+
+            for (int level = 1; level < height; ++level) {
+                while (true) {
+                    node->_M_next[level].store(succs[level], std::memory_order_relaxed);
+
+                    if (preds[level]->_M_next[level].compare_exchange_strong(succs[level], node,
+                            std::memory_order_release, std::memory_order_relaxed)) {
+                        break;
+                    }
+
+                    __find(_key, preds, succs);
+                }
+            }
+
+            int current = this->_M_height.load(std::memory_order_relaxed);
+            while (height > current
+                && !this->_M_height.compare_exchange_weak(current, height, std::memory_order_relaxed)) {
+            }
+
+            this->_M_size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Find the value of a key. Thread-safe and wait-free.
+         *
+         * @param _key The key to find.
+         * @return A pointer to the value, or nullptr if the key is absent.
+         */
+        const value_type *find(const key_type &_key) const {
+            const __node *node = __lower_bound(_key);
+            return node && !_M_compare(_key, node->_M_key) ? &node->_M_value : nullptr;
+        }
+
+        /**
+         * @brief Check if a key exists in the map. Thread-safe and wait-free.
+         *
+         * @param _key The key to check for.
+         * @return `true` if the key exists in the map, `false` otherwise.
+         */
+        bool contains(const key_type &_key) const {
+            return this->find(_key) != nullptr;
+        }
+
+        /**
+         * @brief Find the first entry whose key is not less than a key. Thread-safe.
+         *
+         * @param _key The key to compare against.
+         * @return An iterator to the entry, or end() if there is none.
+         */
+        const_iterator lower_bound(const key_type &_key) const {
+            return const_iterator(__lower_bound(_key));
+        }
+
+        const_iterator begin() const {
+            return const_iterator(this->_M_head->__next(0));
+        }
+
+        const_iterator end() const {
+            return const_iterator(nullptr);
+        }
+
+        /**
+         * @brief Get the number of entries.
+         *
+         * @return The number of entries inserted so far.
+         */
+        size_type size() const {
+            return this->_M_size.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Check if the map is empty.
+         *
+         * @return `true` if the map is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->size() == 0;
+        }
+
+        /**
+         * @brief Get the memory reserved for the entries.
+         *
+         * @return The number of bytes taken by the arena.
+         */
+        size_type memory_usage() const {
+            return this->_M_arena.memory_usage();
+        }
+
+    protected:
+        __node *__new_node(const _kTp &_key, const _vTp &_value, int _height) {
+            size_type bytes = sizeof(__node) + (_height - 1) * sizeof(std::atomic<__node *>);
+            return ::new (this->_M_arena.allocate(bytes)) __node(_key, _value, _height);
+        }
+
+        /**
+         * @brief Draw a height with P(height > h) = 4^-h.
+         */
+        static int __random_height() {
+            thread_local std::uint64_t state =
+                std::hash<std::thread::id>()(std::this_thread::get_id()) * 0x9e3779b97f4a7c15ull | 1;
+
+            // xorshift64*
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            std::uint64_t bits = state * 0x2545f4914f6cdd1dull;
+
+            int height = 1;
+            while (height < max_height && (bits & 3) == 0) {
+                ++height;
+                bits >>= 2;
+            }
+            return height;
+        }
+
+        /**
+         * @brief Find the nodes before and from _key at every level.
+         *
+         * @return `true` if the node at level 0 holds _key.
+         */
+        bool __find(const key_type &_key, __node **_preds, __node **_succs) const {
+            __node *node = this->_M_head;
+
+            for (int level = max_height - 1; level >= 0; --level) {
+                __node *next = node->__next(level);
+
+                while (next && _M_compare(next->_M_key, _key)) {
+                    node = next;
+                    next = node->__next(level);
+                }
+
+                _preds[level] = node;
+                _succs[level] = next;
+            }
+
+            return _succs[0] && !_M_compare(_key, _succs[0]->_M_key);
+        }
+
+        const __node *__lower_bound(const key_type &_key) const {
+            const __node *node = this->_M_head;
+            const __node *next = nullptr;
+
+            for (int level = this->_M_height.load(std::memory_order_relaxed) - 1; level >= 0; --level) {
+                next = node->__next(level);
+
+                while (next && _M_compare(next->_M_key, _key)) {
+                    node = next;
+                    next = node->__next(level);
+                }
+            }
+
+            return next;
+        }
+
+        __concurrent_arena _M_arena;                // The memory of the nodes
+        __node *_M_head;                            // A sentinel linked at every level
+        std::atomic<int> _M_height {1};             // The highest level in use
+        std::atomic<size_type> _M_size {0};         // The number of entries
+        _Compare _M_compare {};                     // The ordering of the keys
+    };
+}
@@ -0,0 +1,357 @@
+/**
+ * @file flat_map.hpp
+ * @brief A sorted map stored in two contiguous vectors.
+ */
+
+#pragma once
+
+#include <algorithm>            ///< For std::stable_sort, std::lower_bound and std::upper_bound
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <initializer_list>     ///< For std::initializer_list
+#include <stdexcept>            ///< For std::out_of_range exception
+#include <type_traits>          ///< For std::is_integral and std::is_same
+#include <utility>              ///< For std::move
+
+#include "pair.hpp"
+#include "sort.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A sorted map stored in two contiguous vectors.
+     *
+     * Keys are kept sorted and unique in one cppds::vector and the values in a
+     * parallel one, so searches only touch keys and both arrays iterate in
+     * order at memory bandwidth. Lookups and range queries are binary searches
+     * returning indices into keys() and values(). Single insertions and
+     * erasures are O(n); build the map in bulk or insert ranges, which are
+     * sorted and merged in one pass.
+     *
+     * @tparam _kTp The type of keys in the map.
+     * @tparam _vTp The type of values in the map.
+     * @tparam _Compare The strict weak ordering of the keys.
+     */
+    template <typename _kTp, typename _vTp, typename _Compare = std::less<_kTp>>
+    class flat_map {
+    protected:
+        using __pair_type = cppds::pair<_kTp, _vTp>;
+
+    public:
+        using key_type = _kTp;              ///< The type of keys in the map.
+        using value_type = _vTp;            ///< The type of values in the map.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /**
+         * @brief Default constructor.
+         */
+        flat_map() = default;
+
+        /**
+         * @brief Constructor that builds the map from a range of key-value pairs.
+         *
+         * When a key repeats, the last of its values is kept.
+         *
+         * @param _first The beginning of the range of pairs.
+         * @param _last The end of the range of pairs.
+         */
+        template <typename _InputIt>
+        flat_map(_InputIt _first, _InputIt _last) {
+            insert(_first, _last);
+        }
+
+        /**
+         * @brief Constructor that builds the map from an initializer list of key-value pairs.
+         *
+         * @param _list An initializer list of key-value pairs.
+         */
+        flat_map(const std::initializer_list<__pair_type> &_list) {
+            operator=(_list);
+        }
+
+        /**
+         * @brief Assignment operator to assign key-value pairs from an initializer list.
+         *
+         * @param _list An initializer list of key-value pairs.
+         * @return A reference to the modified map.
+         */
+        flat_map &operator=(const std::initializer_list<__pair_type> &_list) {
+            this->clear();
+            this->insert(_list.begin(), _list.end());
+            return *this;
+        }
+
+        /**
+         * @brief Insert a key-value pair, replacing the value of an existing key.
+         *
+         * @param _key The key to insert.
+         * @param _value The corresponding value to insert.
+         */
+        void insert(const key_type &_key, const value_type &_value) {
+            size_type idx = this->lower_bound(_key);
+
+            if (idx < this->size() && !_M_compare(_key, this->_M_keys[idx])) {
+                this->_M_values[idx] = _value;
+                return;
+            }
+
+            this->_M_keys.insert(idx, _key);
+            this->_M_values.insert(idx, _value);
+        }
+
+        /**
+         * @brief Insert a range of key-value pairs.
+         *
+         * The pairs are sorted by key and merged with the existing entries into
+         * freshly allocated arrays in one pass. Incoming values replace existing
+         * ones, and the last value of a repeated incoming key wins.
+         *
+         * @param _first The beginning of the range of pairs.
+         * @param _last The end of the range of pairs.
+         */
+        template <typename _InputIt>
+        void insert(_InputIt _first, _InputIt _last) {
+            vector<__pair_type> incoming;
+
+            for (; _first != _last; ++_first) {
+                incoming.push_back(__pair_type((*_first).first, (*_first).second));
+            }
+
+            // Integral keys in ascending order are radix sorted, which is stable
+            // too. Floating-point keys are not: the radix order puts -0.0 before
+            // +0.0, which std::less treats as equal.
+            if constexpr (std::is_integral<key_type>::value
+                && (std::is_same<_Compare, std::less<key_type>>::value
+                    || std::is_same<_Compare, std::less<>>::value)) {
+                cppds::radix_sort(incoming.begin(), incoming.end(), [](const __pair_type &_pair) {
+                    return _pair.first;
+                });
+            }
+            else {
+                std::stable_sort(incoming.begin(), incoming.end(),
+                    [this](const __pair_type &_a, const __pair_type &_b) {
+                        return _M_compare(_a.first, _b.first);
+                    });
+            }
+
+            vector<key_type> keys;
+            vector<value_type> values;
+
+            keys.reserve(this->size() + incoming.size());
+            values.reserve(this->size() + incoming.size());
+
+            size_type i = 0;
+            size_type j = 0;
+
+            while (i < this->size() || j < incoming.size()) {
+                if (j < incoming.size()) {
+                    // Skip to the last of a run of equal incoming keys.
+                    while (j + 1 < incoming.size() && !_M_compare(incoming[j].first, incoming[j + 1].first)) {
+                        ++j;
+                    }
+                }
+
+                if (j == incoming.size()
+                    || (i < this->size() && _M_compare(this->_M_keys[i], incoming[j].first))) {
+                    keys.push_back(std::move(this->_M_keys[i]));
+                    values.push_back(std::move(this->_M_values[i]));
+                    ++i;
+                } else {
+                    if (i < this->size() && !_M_compare(incoming[j].first, this->_M_keys[i])) {
+                        ++i;
+                    }
+                    keys.push_back(std::move(incoming[j].first));
+                    values.push_back(std::move(incoming[j].second));
+                    ++j;
+                }
+            }
+
+            this->_M_keys = std::move(keys);
+            this->_M_values = std::move(values);
+        }
+
+        /**
+         * @brief Erase a key and its corresponding value from the map.
+         *
+         * @param _key The key to erase.
+         * @return `true` if the key was erased, `false` if it was absent.
+         */
+        bool erase(const key_type &_key) {
+            size_type idx = this->find(_key);
+
+            if (idx == this->size()) {
+                return false;
+            }
+
+            this->_M_keys.erase(idx);
+            this->_M_values.erase(idx);
+
+            return true;
+        }
+
+        /**
+         * @brief Check if a key exists in the map.
+         *
+         * @param _key The key to check for.
+         * @return `true` if the key exists in the map, `false` otherwise.
+         */
+        bool contains(const key_type &_key) const {
+            return this->find(_key) != this->size();
+        }
+
+        /**
+         * @brief Find the index of a key.
+         *
+         * @param _key The key to find.
+         * @return The index of the key in keys() and values(), or size() if it is absent.
+         */
+        size_type find(const key_type &_key) const {
+            size_type idx = this->lower_bound(_key);
+
+            if (idx < this->size() && !_M_compare(_key, this->_M_keys[idx])) {
+                return idx;
+            }
+
+            return this->size();
+        }
+
+        /**
+         * @brief Access the value of a key.
+         *
+         * @param _key The key to look up.
+         * @return A reference to the value.
+         * @throw std::out_of_range if the key is absent.
+         */
+        value_type &at(const key_type &_key) {
+            size_type idx = this->find(_key);
+
+            if (idx == this->size()) {
+                throw std::out_of_range("key not found");
+            }
+
+            return this->_M_values[idx];
+        }
+
+        /**
+         * @brief Access the value of a key (const version).
+         *
+         * @param _key The key to look up.
+         * @return A const reference to the value.
+         * @throw std::out_of_range if the key is absent.
+         */
+        const value_type &at(const key_type &_key) const {
+            size_type idx = this->find(_key);
+
+            if (idx == this->size()) {
+                throw std::out_of_range("key not found");
+            }
+
+            return this->_M_values[idx];
+        }
+
+        /**
+         * @brief Find the first key not less than a key.
+         *
+         * @param _key The key to compare against.
+         * @return The index of the entry, or size() if there is none.
+         */
+        size_type lower_bound(const key_type &_key) const {
+            return std::lower_bound(this->_M_keys.begin(), this->_M_keys.end(), _key, _M_compare)
+                - this->_M_keys.begin();
+        }
+
+        /**
+         * @brief Find the first key greater than a key.
+         *
+         * @param _key The key to compare against.
+         * @return The index of the entry, or size() if there is none.
+         */
+        size_type upper_bound(const key_type &_key) const {
+            return std::upper_bound(this->_M_keys.begin(), this->_M_keys.end(), _key, _M_compare)
+                - this->_M_keys.begin();
+        }
+
+        /**
+         * @brief Find the entries in the half-open key range [_low, _high).
+         *
+         * @param _low The smallest key in the range.
+         * @param _high The key past the range.
+         * @return The indices of the first entry in the range and past the last.
+         */
+        pair<size_type, size_type> range(const key_type &_low, const key_type &_high) const {
+            size_type first = this->lower_bound(_low);
+            size_type last = std::lower_bound(this->_M_keys.begin() + first, this->_M_keys.end(), _high, _M_compare)
+                - this->_M_keys.begin();
+            return pair<size_type, size_type>(first, last);
+        }
+
+        /**
+         * @brief Access the sorted keys.
+         *
+         * @return The keys, in order.
+         */
+        const vector<key_type> &keys() const {
+            return this->_M_keys;
+        }
+
+        /**
+         * @brief Access the values, in the order of their keys.
+         *
+         * @return The values.
+         */
+        vector<value_type> &values() {
+            return this->_M_values;
+        }
+
+        /**
+         * @brief Access the values, in the order of their keys (const version).
+         *
+         * @return The values.
+         */
+        const vector<value_type> &values() const {
+            return this->_M_values;
+        }
+
+        /**
+         * @brief Reserve space for a number of entries.
+         *
+         * @param _capacity The number of entries.
+         */
+        void reserve(size_type _capacity) {
+            this->_M_keys.reserve(_capacity);
+            this->_M_values.reserve(_capacity);
+        }
+
+        /**
+         * @brief Clear the map, keeping its storage.
+         */
+        void clear() {
+            this->_M_keys.clear();
+            this->_M_values.clear();
+        }
+
+        /**
+         * @brief Get the size of the map.
+         *
+         * @return The number of key-value pairs in the map.
+         */
+        size_type size() const {
+            return this->_M_keys.size();
+        }
+
+        /**
+         * @brief Check if the map is empty.
+         *
+         * @return `true` if the map is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_keys.empty();
+        }
+
+    protected:
+        vector<key_type> _M_keys {};        // Sorted, unique keys
+        vector<value_type> _M_values {};    // Values, parallel to the keys
+        _Compare _M_compare {};             // The ordering of the keys
+    };
+}
@@ -0,0 +1,269 @@
+/**
+ * @file flat_set.hpp
+ * @brief A sorted set stored in a contiguous vector.
+ */
+
+#pragma once
+
+#include <algorithm>            ///< For std::unique, std::lower_bound and std::inplace_merge
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <initializer_list>     ///< For std::initializer_list
+
+#include "pair.hpp"
+#include "sort.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A sorted set stored in a contiguous vector.
+     *
+     * Elements are kept sorted and unique in a single cppds::vector, so the set
+     * has no per-element overhead, iterates in order at memory bandwidth and
+     * answers lookups and range queries by binary search. Single insertions
+     * and erasures are O(n); build it in bulk or insert ranges, which are
+     * sorted and merged in one pass.
+     *
+     * @tparam _Tp The type of elements stored in the set.
+     * @tparam _Compare The strict weak ordering of the elements.
+     */
+    template <typename _Tp, typename _Compare = std::less<_Tp>>
+    class flat_set {
+    public:
+        using key_type = _Tp;                               ///< The type of elements stored in the set.
+        using value_type = _Tp;                             ///< The type of elements stored in the set.
+        using size_type = std::size_t;                      ///< The type used for size-related operations.
+        using const_iterator = const value_type *;          ///< The iterator type; elements are immutable.
+
+        /**
+         * @brief Default constructor.
+         */
+        flat_set() = default;
+
+        /**
+         * @brief Constructor that builds the set from an iterator range.
+         *
+         * @param _first The beginning of the range of values.
+         * @param _last The end of the range of values.
+         */
+        template <typename _InputIt>
+        flat_set(_InputIt _first, _InputIt _last) {
+            insert(_first, _last);
+        }
+
+        /**
+         * @brief Constructor that builds the set from an initializer list.
+         *
+         * @param _list An initializer list of values.
+         */
+        flat_set(const std::initializer_list<value_type> &_list) {
+            operator=(_list);
+        }
+
+        /**
+         * @brief Assignment operator to assign values from an initializer list.
+         *
+         * @param _list An initializer list of values.
+         * @return A reference to the modified set.
+         */
+        flat_set &operator=(const std::initializer_list<value_type> &_list) {
+            this->clear();
+            this->insert(_list.begin(), _list.end());
+            return *this;
+        }
+
+        /**
+         * @brief Insert a value into the set.
+         *
+         * @param _value The value to insert.
+         * @return `true` if the value was inserted, `false` if it was present.
+         */
+        bool insert(const value_type &_value) {
+            size_type idx = this->lower_bound(_value);
+
+            if (idx < this->size() && !_M_compare(_value, this->_M_data[idx])) {
+                return false;
+            }
+
+            this->_M_data.insert(idx, _value);
+
+            return true;
+        }
+
+        /**
+         * @brief Insert a range of values into the set.
+         *
+         * The values are appended, sorted and deduplicated, then merged with
+         * the existing elements in place.
+         *
+         * @param _first The beginning of the range of values.
+         * @param _last The end of the range of values.
+         */
+        template <typename _InputIt>
+        void insert(_InputIt _first, _InputIt _last) {
+            size_type old_size = this->size();
+
+            this->_M_data.append(_first, _last);
+
+            value_type *data = this->_M_data.data();
+            value_type *middle = data + old_size;
+            value_type *end = data + this->size();
+
+            cppds::sort(middle, end, _M_compare);
+
+            if (old_size) {
+                std::inplace_merge(data, middle, end, _M_compare);
+            }
+
+            value_type *unique = std::unique(data, end, [this](const value_type &_a, const value_type &_b) {
+                return !_M_compare(_a, _b) && !_M_compare(_b, _a);
+            });
+
+            this->_M_data.erase(unique - data, this->size());
+        }
+
+        /**
+         * @brief Erase a value from the set.
+         *
+         * @param _key The value to erase.
+         * @return `true` if the value was erased, `false` if it was absent.
+         */
+        bool erase(const key_type &_key) {
+            size_type idx = this->find(_key);
+
+            if (idx == this->size()) {
+                return false;
+            }
+
+            this->_M_data.erase(idx);
+
+            return true;
+        }
+
+        /**
+         * @brief Check if a value exists in the set.
+         *
+         * @param _key The value to check for.
+         * @return `true` if the value exists in the set, `false` otherwise.
+         */
+        bool contains(const key_type &_key) const {
+            return this->find(_key) != this->size();
+        }
+
+        /**
+         * @brief Find the index of a value.
+         *
+         * @param _key The value to find.
+         * @return The index of the value, or size() if it is absent.
+         */
+        size_type find(const key_type &_key) const {
+            size_type idx = this->lower_bound(_key);
+
+            if (idx < this->size() && !_M_compare(_key, this->_M_data[idx])) {
+                return idx;
+            }
+
+            return this->size();
+        }
+
+        /**
+         * @brief Find the first element not less than a key.
+         *
+         * @param _key The key to compare against.
+         * @return The index of the element, or size() if there is none.
+         */
+        size_type lower_bound(const key_type &_key) const {
+            return std::lower_bound(this->begin(), this->end(), _key, _M_compare) - this->begin();
+        }
+
+        /**
+         * @brief Find the first element greater than a key.
+         *
+         * @param _key The key to compare against.
+         * @return The index of the element, or size() if there is none.
+         */
+        size_type upper_bound(const key_type &_key) const {
+            return std::upper_bound(this->begin(), this->end(), _key, _M_compare) - this->begin();
+        }
+
+        /**
+         * @brief Find the elements in the half-open key range [_low, _high).
+         *
+         * @param _low The smallest key in the range.
+         * @param _high The key past the range.
+         * @return The indices of the first element in the range and past the last.
+         */
+        pair<size_type, size_type> range(const key_type &_low, const key_type &_high) const {
+            size_type first = this->lower_bound(_low);
+            size_type last = std::lower_bound(this->begin() + first, this->end(), _high, _M_compare) - this->begin();
+            return pair<size_type, size_type>(first, last);
+        }
+
+        /**
+         * @brief Reserve space for a number of elements.
+         *
+         * @param _capacity The number of elements.
+         */
+        void reserve(size_type _capacity) {
+            this->_M_data.reserve(_capacity);
+        }
+
+        /**
+         * @brief Clear the set, keeping its storage.
+         */
+        void clear() {
+            this->_M_data.clear();
+        }
+
+        /**
+         * @brief Get the size of the set.
+         *
+         * @return The number of elements in the set.
+         */
+        size_type size() const {
+            return this->_M_data.size();
+        }
+
+        /**
+         * @brief Check if the set is empty.
+         *
+         * @return `true` if the set is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_data.empty();
+        }
+
+        /**
+         * @brief Get an iterator to the smallest element.
+         *
+         * @return A pointer to the first element.
+         */
+        const_iterator begin() const {
+            return this->_M_data.begin();
+        }
+
+        /**
+         * @brief Get an iterator past the largest element.
+         *
+         * @return A pointer past the last element.
+         */
+        const_iterator end() const {
+            return this->_M_data.end();
+        }
+
+        /**
+         * @brief Access an element by its index in sorted order.
+         *
+         * @param _index The index of the element.
+         * @return A const reference to the element.
+         */
+        const value_type &operator[](size_type _index) const {
+            return this->_M_data[_index];
+        }
+
+    protected:
+        vector<value_type> _M_data {};      // Sorted, unique elements
+        _Compare _M_compare {};             // The ordering of the elements
+    };
+}
@@ -3,8 +3,12 @@
 #include <cstddef>
 #include <cstdint>
 
+#ifdef CPPDS_HASH_STATS
+#include <chrono>
+#endif
+
 namespace cppds {
-    size_t __fnv1hash(const void *_data, std::size_t _size) {
+    inline size_t __fnv1hash(const void *_data, std::size_t _size) {
         const std::uint32_t __FNV_BASIS32 = 0x811c9dc5u;
         const std::uint32_t __FNV_PRIME32 = 0x01000193u;
 
@@ -19,4 +23,135 @@ namespace cppds {
 
         return hash;
     }
+
+#ifdef CPPDS_HASH_STATS
+    /**
+     * @brief Occupancy and probing statistics of an open-addressing table.
+     *
+     * Only available when CPPDS_HASH_STATS is defined before including the
+     * containers; otherwise neither the statistics nor their bookkeeping are
+     * compiled.
+     */
+    struct hash_stats {
+        static constexpr std::size_t probe_buckets = 32;    ///< Histogram buckets; the last one also counts longer probes.
+        static constexpr std::size_t group_size = 16;       ///< Slots per group in the occupancy distribution.
+
+        std::size_t size {};                                ///< The number of elements.
+        std::size_t capacity {};                            ///< The number of slots.
+        double load_factor {};                              ///< size / capacity.
+        double bytes_per_element {};                        ///< Bytes of slot storage per element.
+
+        std::size_t hit_probes[probe_buckets] {};           ///< Slots probed to find each element, by probe length.
+        std::size_t miss_probes[probe_buckets] {};          ///< Slots probed by a miss starting at each slot, by probe length.
+        double mean_hit_probe {};                           ///< The mean successful probe length.
+        double mean_miss_probe {};                          ///< The mean unsuccessful probe length.
+        std::size_t max_displacement {};                    ///< The largest distance of an element from its home slot.
+
+        std::size_t group_occupancy[group_size + 1] {};     ///< The number of groups with 0..group_size occupied slots.
+
+        std::size_t rehashes {};                            ///< The number of times the table grew.
+        std::uint64_t rehash_nanoseconds {};                ///< Total time spent growing the table.
+    };
+
+    /**
+     * @brief Rehash counters kept by a container while statistics are enabled.
+     */
+    struct __rehash_stats {
+        std::size_t count {};
+        std::uint64_t nanoseconds {};
+        unsigned depth {};
+    };
+
+    /**
+     * @brief Times a rehash. Nested rehashes are counted but not timed twice.
+     */
+    class __rehash_timer {
+    public:
+        explicit __rehash_timer(__rehash_stats &_stats) :
+            _M_stats(_stats), _M_start(std::chrono::steady_clock::now()) {
+            ++_M_stats.count;
+            ++_M_stats.depth;
+        }
+
+        ~__rehash_timer() {
+            if (--_M_stats.depth == 0) {
+                _M_stats.nanoseconds += std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - _M_start).count());
+            }
+        }
+
+    private:
+        __rehash_stats &_M_stats;
+        std::chrono::steady_clock::time_point _M_start;
+    };
+
+    /**
+     * @brief Compute the statistics of a linear-probing table from its hashes.
+     *
+     * Slots hold the stored hash, 0 when empty, and an element's home slot is
+     * its hash modulo the capacity. Probes do not wrap around; a miss that
+     * runs off the end probes every remaining slot.
+     *
+     * @param _hdata The stored hashes.
+     * @param _capacity The number of slots.
+     * @param _slot_bytes The bytes of storage per slot across all arrays.
+     * @param _rehash The rehash counters of the container.
+     * @return The statistics.
+     */
+    inline hash_stats __collect_hash_stats(const std::size_t *_hdata, std::size_t _capacity,
+        std::size_t _slot_bytes, const __rehash_stats &_rehash) {
+        hash_stats stats;
+
+        const std::size_t last_bucket = hash_stats::probe_buckets - 1;
+
+        std::size_t hit_total = 0;
+        std::size_t miss_total = 0;
+
+        for (std::size_t i = 0; i < _capacity; ++i) {
+            if (_hdata[i]) {
+                std::size_t displacement = i - _hdata[i] % _capacity;
+                std::size_t probe = displacement + 1;
+
+                ++stats.size;
+                ++stats.hit_probes[probe < last_bucket ? probe : last_bucket];
+                hit_total += probe;
+
+                if (displacement > stats.max_displacement) {
+                    stats.max_displacement = displacement;
+                }
+            }
+        }
+
+        // A miss starting at slot i probes up to and including the next empty
+        // slot; walk backwards keeping the distance to it.
+        std::size_t run = 0;
+
+        for (std::size_t i = _capacity; i-- > 0;) {
+            run = _hdata[i] ? run + 1 : 1;
+
+            ++stats.miss_probes[run < last_bucket ? run : last_bucket];
+            miss_total += run;
+        }
+
+        for (std::size_t g = 0; g < _capacity; g += hash_stats::group_size) {
+            std::size_t occupied = 0;
+
+            for (std::size_t i = g; i < _capacity && i < g + hash_stats::group_size; ++i) {
+                occupied += _hdata[i] != 0;
+            }
+
+            ++stats.group_occupancy[occupied];
+        }
+
+        stats.capacity = _capacity;
+        stats.load_factor = _capacity ? double(stats.size) / double(_capacity) : 0.0;
+        stats.bytes_per_element = stats.size ? double(_capacity * _slot_bytes) / double(stats.size) : 0.0;
+        stats.mean_hit_probe = stats.size ? double(hit_total) / double(stats.size) : 0.0;
+        stats.mean_miss_probe = _capacity ? double(miss_total) / double(_capacity) : 0.0;
+        stats.rehashes = _rehash.count;
+        stats.rehash_nanoseconds = _rehash.nanoseconds;
+
+        return stats;
+    }
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,323 @@
+/**
+ * @file indexed_priority_queue.hpp
+ * @brief A d-ary heap over dense integer handles with decrease-key.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <utility>              ///< For std::move
+
+#include "pair.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A min-priority queue of keys addressed by dense integer handles.
+     *
+     * Each handle in [0, n) is in the queue at most once, and a position
+     * array indexed by handle tracks where its entry sits in the heap, so
+     * the key of a queued handle can be changed or the handle removed in
+     * O(log n) instead of pushing duplicates. The heap stores the keys next
+     * to their handles so sifting compares without indirection, and it is
+     * d-ary like cppds::priority_queue.
+     *
+     * Unlike cppds::priority_queue, top() is the smallest key according to
+     * _Compare, which is the convention of the shortest-path and spanning
+     * tree algorithms this queue is meant for.
+     *
+     * @tparam _Tp The type of keys.
+     * @tparam _Compare The strict weak ordering of the keys.
+     * @tparam _Arity The number of children of each heap node, at least 2.
+     */
+    template <typename _Tp, typename _Compare = std::less<_Tp>, std::size_t _Arity = 4>
+    class indexed_priority_queue {
+        static_assert(_Arity >= 2, "a heap needs at least two children per node");
+
+    public:
+        using key_type = _Tp;                   ///< The type of keys.
+        using size_type = std::size_t;          ///< The type used for size-related operations.
+        using handle_type = std::size_t;        ///< The type of handles.
+        using key_compare = _Compare;           ///< The ordering of the keys.
+
+        static constexpr size_type arity = _Arity;  ///< The number of children of each heap node.
+
+        /**
+         * @brief Constructor that sizes the position array for a number of handles.
+         *
+         * Handles outside the initial range are accepted too; the position
+         * array grows to the largest handle pushed.
+         *
+         * @param _handles The number of handles, i.e. one past the largest expected handle.
+         * @param _compare The ordering of the keys.
+         */
+        explicit indexed_priority_queue(size_type _handles = 0, const key_compare &_compare = key_compare())
+            : _M_compare(_compare) {
+            this->_M_positions.resize(_handles, __npos);
+        }
+
+        /**
+         * @brief Add a handle with a key.
+         *
+         * @param _handle The handle to add.
+         * @param _key The key of the handle.
+         * @return `true` if the handle was added, `false` if it was already queued.
+         */
+        bool push(handle_type _handle, const key_type &_key) {
+            if (_handle >= this->_M_positions.size()) {
+                this->_M_positions.resize(_handle + 1, __npos);
+            } else if (this->_M_positions[_handle] != __npos) {
+                return false;
+            }
+
+            this->_M_heap.push_back(entry(_key, _handle));
+            __sift_up(this->size() - 1, std::move(this->_M_heap.back()));
+
+            return true;
+        }
+
+        /**
+         * @brief Remove the handle with the smallest key.
+         *
+         * The queue must not be empty.
+         */
+        void pop() {
+            this->_M_positions[this->_M_heap[0].second] = __npos;
+            __remove_at(0);
+        }
+
+        /**
+         * @brief Access the smallest key.
+         *
+         * The queue must not be empty.
+         *
+         * @return A const reference to the smallest key.
+         */
+        const key_type &top() const {
+            return this->_M_heap[0].first;
+        }
+
+        /**
+         * @brief Get the handle with the smallest key.
+         *
+         * The queue must not be empty.
+         *
+         * @return The handle of the top entry.
+         */
+        handle_type top_handle() const {
+            return this->_M_heap[0].second;
+        }
+
+        /**
+         * @brief Check if a handle is queued.
+         *
+         * @param _handle The handle to check for.
+         * @return `true` if the handle is in the queue, `false` otherwise.
+         */
+        bool contains(handle_type _handle) const {
+            return _handle < this->_M_positions.size() && this->_M_positions[_handle] != __npos;
+        }
+
+        /**
+         * @brief Get the key of a queued handle.
+         *
+         * @param _handle A handle in the queue.
+         * @return A const reference to its key.
+         */
+        const key_type &key(handle_type _handle) const {
+            return this->_M_heap[this->_M_positions[_handle]].first;
+        }
+
+        /**
+         * @brief Lower the key of a queued handle.
+         *
+         * @param _handle A handle in the queue.
+         * @param _key The new key, which must not be greater than the current one.
+         */
+        void decrease_key(handle_type _handle, const key_type &_key) {
+            __sift_up(this->_M_positions[_handle], entry(_key, _handle));
+        }
+
+        /**
+         * @brief Raise the key of a queued handle.
+         *
+         * @param _handle A handle in the queue.
+         * @param _key The new key, which must not be less than the current one.
+         */
+        void increase_key(handle_type _handle, const key_type &_key) {
+            __sift_down(this->_M_positions[_handle], entry(_key, _handle));
+        }
+
+        /**
+         * @brief Set the key of a handle, adding the handle if it is not queued.
+         *
+         * @param _handle The handle to update.
+         * @param _key The new key.
+         */
+        void update(handle_type _handle, const key_type &_key) {
+            if (!this->contains(_handle)) {
+                this->push(_handle, _key);
+            } else if (_M_compare(_key, this->key(_handle))) {
+                this->decrease_key(_handle, _key);
+            } else {
+                this->increase_key(_handle, _key);
+            }
+        }
+
+        /**
+         * @brief Remove a handle from the queue.
+         *
+         * @param _handle The handle to remove.
+         * @return `true` if the handle was removed, `false` if it was not queued.
+         */
+        bool erase(handle_type _handle) {
+            if (!this->contains(_handle)) {
+                return false;
+            }
+
+            size_type index = this->_M_positions[_handle];
+            this->_M_positions[_handle] = __npos;
+            __remove_at(index);
+
+            return true;
+        }
+
+        /**
+         * @brief Reserve space for a number of queued handles.
+         *
+         * @param _capacity The number of handles.
+         */
+        void reserve(size_type _capacity) {
+            this->_M_heap.reserve(_capacity);
+        }
+
+        /**
+         * @brief Remove all handles in O(size()), keeping the storage.
+         */
+        void clear() {
+            for (size_type i = 0; i < this->size(); ++i) {
+                this->_M_positions[this->_M_heap[i].second] = __npos;
+            }
+
+            this->_M_heap.clear();
+        }
+
+        /**
+         * @brief Get the number of queued handles.
+         *
+         * @return The number of handles in the queue.
+         */
+        size_type size() const {
+            return this->_M_heap.size();
+        }
+
+        /**
+         * @brief Check if the queue is empty.
+         *
+         * @return `true` if the queue is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_heap.empty();
+        }
+
+    protected:
+        using entry = pair<key_type, handle_type>;
+
+        static constexpr size_type __npos = size_type(-1);
+
+        static size_type __parent(size_type _index) {
+            return (_index - 1) / _Arity;
+        }
+
+        static size_type __first_child(size_type _index) {
+            return _index * _Arity + 1;
+        }
+
+        /**
+         * @brief Find the smallest child of a node that has at least one.
+         */
+        size_type __best_child(size_type _index) const {
+            const entry *heap = this->_M_heap.data();
+            size_type first = __first_child(_index);
+            size_type last = first + _Arity <= this->size() ? first + _Arity : this->size();
+            size_type best = first;
+
+            for (size_type i = first + 1; i < last; ++i) {
+                if (_M_compare(heap[i].first, heap[best].first)) {
+                    best = i;
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Place an entry into the hole at _index, recording its position.
+         */
+        void __place(size_type _index, entry &&_entry) {
+            this->_M_positions[_entry.second] = _index;
+            this->_M_heap[_index] = std::move(_entry);
+        }
+
+        /**
+         * @brief Move an entry up from a hole at _index to its place.
+         */
+        void __sift_up(size_type _index, entry _entry) {
+            while (_index > 0) {
+                size_type parent = __parent(_index);
+
+                if (!_M_compare(_entry.first, this->_M_heap[parent].first)) {
+                    break;
+                }
+
+                __place(_index, std::move(this->_M_heap[parent]));
+                _index = parent;
+            }
+
+            __place(_index, std::move(_entry));
+        }
+
+        /**
+         * @brief Move an entry down from a hole at _index to its place.
+         */
+        void __sift_down(size_type _index, entry _entry) {
+            while (__first_child(_index) < this->size()) {
+                size_type child = __best_child(_index);
+
+                if (!_M_compare(this->_M_heap[child].first, _entry.first)) {
+                    break;
+                }
+
+                __place(_index, std::move(this->_M_heap[child]));
+                _index = child;
+            }
+
+            __place(_index, std::move(_entry));
+        }
+
+        /**
+         * @brief Fill the hole at _index with the last entry.
+         */
+        void __remove_at(size_type _index) {
+            entry last = std::move(this->_M_heap.back());
+            this->_M_heap.pop_back();
+
+            if (_index == this->size()) {
+                return;
+            }
+
+            // The last entry may belong above or below the hole.
+            if (_index > 0 && _M_compare(last.first, this->_M_heap[__parent(_index)].first)) {
+                __sift_up(_index, std::move(last));
+            } else {
+                __sift_down(_index, std::move(last));
+            }
+        }
+
+        vector<entry> _M_heap {};                   // Keys and handles, level by level
+        vector<size_type> _M_positions {};          // Heap index of each handle, or __npos
+        _Compare _M_compare {};                     // The ordering of the keys
+    };
+}
@@ -9,11 +9,15 @@
 #include <cstdlib>
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "hash.hpp" // Include necessary header(s)
 #include "pair.hpp"
 
 namespace cppds {
+    struct __parallel_hash_access;
+
     /**
      * @brief A custom map data structure.
      *
@@ -26,6 +30,8 @@ namespace cppds {
     template <typename _kTp, typename _vTp>
     class map {
     protected:
+        friend struct __parallel_hash_access;
+
         using __pair_type = cppds::pair<_kTp, _vTp>;
 
     public:
@@ -93,7 +99,7 @@ namespace cppds {
          * @brief Destructor to clean up the map.
          */
         ~map() {
-            this->clear();
+            this->release();
         }
 
         /**
@@ -176,13 +182,84 @@ namespace cppds {
         }
 
         /**
-         * @brief Clear the map, removing all key-value pairs.
+         * @brief Find the value of a key.
+         *
+         * @param _key The key to find.
+         * @return A pointer to the value, or nullptr if the key is absent.
          */
-        void clear() {
+        value_type *find(const key_type &_key) {
+            return const_cast<value_type *>(static_cast<const map *>(this)->find(_key));
+        }
+
+        /**
+         * @brief Find the value of a key (const version).
+         *
+         * @param _key The key to find.
+         * @return A pointer to the value, or nullptr if the key is absent.
+         */
+        const value_type *find(const key_type &_key) const {
+            // Calculate hash using a custom hash function
+            size_type hash = __fnv1hash(&_key, sizeof(_key));
+
+            size_t idx = this->capacity() ? hash % this->capacity() : 0;
+
+            while (idx < this->capacity()
+                && this->_M_hdata[idx]
+                && this->_M_hdata[idx] != hash) {
+                ++idx;
+            }
+
+            return idx < this->capacity() && this->_M_hdata[idx] == hash ? &this->_M_vdata[idx] : nullptr;
+        }
+
+        /**
+         * @brief Visit every key-value pair, in no particular order.
+         *
+         * @param _func Called as `_func(key, value)` for each pair.
+         */
+        template <typename _Func>
+        void for_each(_Func _func) const {
             for (size_type i = 0; i < this->capacity(); ++i) {
                 if (this->_M_hdata[i]) {
-                    this->_M_kdata[i].~key_type();
-                    this->_M_vdata[i].~value_type();
+                    _func(this->_M_kdata[i], this->_M_vdata[i]);
+                }
+            }
+        }
+
+        /**
+         * @brief Clear the map, removing all key-value pairs.
+         *
+         * The slot arrays are kept for reuse: only the hash array is reset,
+         * and slots are not visited at all when the key-value pairs are trivially
+         * destructible. Call release() or shrink_to_fit() to return the memory.
+         */
+        void clear() {
+            if constexpr (!std::is_trivially_destructible<key_type>::value
+                || !std::is_trivially_destructible<value_type>::value) {
+                for (size_type i = 0; i < this->capacity(); ++i) {
+                    if (this->_M_hdata[i]) {
+                        this->_M_kdata[i].~key_type();
+                        this->_M_vdata[i].~value_type();
+                    }
+                }
+            }
+
+            if (this->capacity()) {
+                std::memset(this->_M_hdata, 0, this->capacity() * sizeof(size_type));
+            }
+        }
+
+        /**
+         * @brief Clear the map and free its storage.
+         */
+        void release() {
+            if constexpr (!std::is_trivially_destructible<key_type>::value
+                || !std::is_trivially_destructible<value_type>::value) {
+                for (size_type i = 0; i < this->capacity(); ++i) {
+                    if (this->_M_hdata[i]) {
+                        this->_M_kdata[i].~key_type();
+                        this->_M_vdata[i].~value_type();
+                    }
                 }
             }
 
@@ -197,6 +274,50 @@ namespace cppds {
             this->_M_vdata = nullptr;
         }
 
+        /**
+         * @brief Reduce the capacity to the smallest that holds the key-value pairs.
+         */
+        void shrink_to_fit() {
+            if (this->empty()) {
+                this->release();
+                return;
+            }
+
+            map other;
+
+            other.reserve(this->size());
+
+            for (size_type i = 0; i < this->capacity(); ++i) {
+                if (this->_M_hdata[i]) {
+                    other.insert(this->_M_kdata[i], this->_M_vdata[i]);
+                }
+            }
+
+            if (other.capacity() < this->capacity()) {
+#ifdef CPPDS_HASH_STATS
+                // The rebuild counts as one more rehash of this table.
+                other._M_rehash_stats.count += this->_M_rehash_stats.count;
+                other._M_rehash_stats.nanoseconds += this->_M_rehash_stats.nanoseconds;
+#endif
+                this->swap(other);
+            }
+        }
+
+        /**
+         * @brief Exchange the contents of two maps without copying.
+         *
+         * @param _other The map to swap with.
+         */
+        void swap(map &_other) {
+            std::swap(this->_M_hdata, _other._M_hdata);
+            std::swap(this->_M_kdata, _other._M_kdata);
+            std::swap(this->_M_vdata, _other._M_vdata);
+            std::swap(this->_M_capacity, _other._M_capacity);
+#ifdef CPPDS_HASH_STATS
+            std::swap(this->_M_rehash_stats, _other._M_rehash_stats);
+#endif
+        }
+
         /**
          * @brief Get the size of the map.
          *
@@ -223,6 +344,20 @@ namespace cppds {
             return this->size() == 0;
         }
 
+#ifdef CPPDS_HASH_STATS
+        /**
+         * @brief Get occupancy and probing statistics of the map.
+         *
+         * Scans the whole table; only available when CPPDS_HASH_STATS is defined.
+         *
+         * @return The statistics.
+         */
+        hash_stats stats() const {
+            return __collect_hash_stats(this->_M_hdata, this->capacity(),
+                sizeof(size_type) + sizeof(key_type) + sizeof(value_type), this->_M_rehash_stats);
+        }
+#endif
+
     protected:
         /**
          * @brief Get the current capacity of the map.
@@ -243,6 +378,10 @@ namespace cppds {
                 return;
             }
 
+#ifdef CPPDS_HASH_STATS
+            __rehash_timer timer(this->_M_rehash_stats);
+#endif
+
             size_type old_capacity = this->capacity();
 
             this->_M_capacity = _capacity;
@@ -251,7 +390,7 @@ namespace cppds {
                 std::realloc(this->_M_vdata, _capacity * sizeof(value_type));
 
             this->_M_kdata = (key_type *)
-                std::realloc(this->_M_kdata, _capacity * sizeof(value_type));
+                std::realloc(this->_M_kdata, _capacity * sizeof(key_type));
 
             this->_M_hdata = (size_type *)
                 std::realloc(this->_M_hdata, _capacity * sizeof(size_type));
@@ -271,5 +410,9 @@ namespace cppds {
         key_type *_M_kdata {}; // Array to store keys
         value_type *_M_vdata {}; // Array to store values
         size_type _M_capacity {}; // Current capacity of the map
+
+#ifdef CPPDS_HASH_STATS
+        __rehash_stats _M_rehash_stats {}; // Rehash counters for stats()
+#endif
     };
 }
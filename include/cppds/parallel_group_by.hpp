@@ -0,0 +1,103 @@
+/**
+ * @file parallel_group_by.hpp
+ * @brief Parallel group-by aggregation into a cppds::map.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+
+#include "map.hpp"
+#include "pair.hpp"
+#include "parallel_hash_build.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief Aggregate a range of rows per key on the workers of a pool.
+     *
+     * The input is cut into chunks, a few per worker, and each chunk is
+     * pre-aggregated into a private map, so no map is shared between tasks.
+     * The partial aggregates are then merged by cppds::build_parallel(), which
+     * radix-partitions them by hash into regions of the result table and
+     * merges each region in its own task with the combine function.
+     *
+     * Values of a key are combined in input order, so the result matches a
+     * sequential left fold whenever the combine function is associative; it
+     * need not be commutative.
+     *
+     * @param _first The beginning of the range of rows.
+     * @param _last The end of the range of rows.
+     * @param _result The map that receives the aggregates; its contents are replaced.
+     * @param _extract Called as `_extract(row)`; returns a pair of the key and value of the row.
+     * @param _combine Called as `_combine(accumulated, value)`; returns the combined value.
+     * @param _pool The pool whose workers aggregate the rows.
+     */
+    template <typename _RandomIt, typename _kTp, typename _vTp, typename _Extract, typename _Combine>
+    void parallel_group_by(_RandomIt _first, _RandomIt _last, map<_kTp, _vTp> &_result,
+            _Extract _extract, _Combine _combine, thread_pool &_pool = thread_pool::default_pool()) {
+        using key_type = _kTp;
+        using value_type = _vTp;
+        using size_type = std::size_t;
+        using __entry_type = pair<key_type, value_type>;
+
+        size_type count = size_type(_last - _first);
+        if (count == 0) {
+            _result.release();
+            return;
+        }
+
+        // A few chunks per worker let stealing even out skew.
+        size_type chunks = 4 * _pool.size();
+        size_type chunk_size = (count + chunks - 1) / chunks;
+
+        vector<vector<__entry_type>> aggregated;
+        aggregated.resize(chunks);
+
+        _pool.parallel_for(0, chunks, 1, [&](size_type _chunk) {
+            size_type begin = _chunk * chunk_size < count ? _chunk * chunk_size : count;
+            size_type end = begin + chunk_size < count ? begin + chunk_size : count;
+
+            map<key_type, value_type> local;
+
+            for (size_type i = begin; i < end; ++i) {
+                auto row = _extract(_first[i]);
+                value_type *value = local.find(row.first);
+
+                if (value) {
+                    *value = _combine(*value, row.second);
+                }
+                else {
+                    local.insert(row.first, row.second);
+                }
+            }
+
+            local.for_each([&](const key_type &_key, const value_type &_value) {
+                aggregated[_chunk].push_back(__entry_type(_key, _value));
+            });
+        });
+
+        // Concatenate the chunks in input order, so that the values of a key
+        // still reach the combine function in input order.
+        vector<size_type> offsets;
+        offsets.resize(chunks + 1, size_type(0));
+
+        for (size_type chunk = 0; chunk < chunks; ++chunk) {
+            offsets[chunk + 1] = offsets[chunk] + aggregated[chunk].size();
+        }
+
+        vector<__entry_type> entries;
+        entries.resize(offsets[chunks]);
+
+        _pool.parallel_for(0, chunks, 1, [&](size_type _chunk) {
+            for (size_type i = 0; i < aggregated[_chunk].size(); ++i) {
+                entries[offsets[_chunk] + i] = aggregated[_chunk][i];
+            }
+            aggregated[_chunk].release();
+        });
+
+        cppds::build_parallel(_result, entries.begin(), entries.end(), _combine, _pool);
+    }
+}
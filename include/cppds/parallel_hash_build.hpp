@@ -0,0 +1,329 @@
+/**
+ * @file parallel_hash_build.hpp
+ * @brief Parallel construction of the open-addressing tables of set and map.
+ *
+ * Kept out of set.hpp and map.hpp so that only the callers of
+ * build_parallel() depend on the thread pool.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <cstdlib>              ///< For std::calloc and std::malloc
+
+#include "hash.hpp"
+#include "map.hpp"
+#include "set.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief Fill an empty, zeroed open-addressing table from a range in parallel.
+     *
+     * The table is split into equal regions by home slot, one per partition,
+     * and the keys are radix-partitioned by the region of their home slot so
+     * each partition is inserted by one task that only writes inside its
+     * region. Within a partition keys keep their input order, so the
+     * occurrences of a repeated key reach _place() in input order. A probe
+     * that would run past the end of its region is deferred, and the deferred
+     * keys are inserted sequentially at the end, still in input order per key,
+     * which may probe across regions and grow the table.
+     *
+     * @param _first The beginning of the range of elements.
+     * @param _count The number of elements.
+     * @param _hdata The hash array of the table, all zero.
+     * @param _capacity The number of slots, a power of two.
+     * @param _pool The pool running the partitions.
+     * @param _hash The hash of an element, called as _hash(element).
+     * @param _place Store an element in a slot, called as _place(slot, element, occupied),
+     *               where occupied tells whether the slot already holds the same key.
+     * @param _insert Insert a deferred element sequentially, called as _insert(element).
+     */
+    template <typename _RandomIt, typename _Hash, typename _Place, typename _Insert>
+    void __parallel_hash_build(_RandomIt _first, std::size_t _count, std::size_t *_hdata, std::size_t _capacity,
+            thread_pool &_pool, _Hash _hash, _Place _place, _Insert _insert) {
+        using size_type = std::size_t;
+
+        // Powers of two, so a region is an exact range of home slots. A few
+        // partitions per worker let stealing even out skewed partitions.
+        size_type parts = 1;
+        while (parts < 4 * _pool.size() && parts < _capacity) {
+            parts *= 2;
+        }
+
+        size_type region_size = _capacity / parts;
+
+        // The input is cut into as many chunks as there are partitions.
+        size_type chunk_size = (_count + parts - 1) / parts;
+
+        vector<size_type> hashes;
+        hashes.resize(_count, default_init);
+
+        vector<size_type> offsets;
+        offsets.resize(parts * parts, size_type(0));
+
+        // Hash each chunk and count its keys per region.
+        _pool.parallel_for(0, parts, 1, [&](size_type _chunk) {
+            size_type *counts = offsets.data() + _chunk * parts;
+            size_type end = (_chunk + 1) * chunk_size < _count ? (_chunk + 1) * chunk_size : _count;
+
+            for (size_type i = _chunk * chunk_size; i < end; ++i) {
+                size_type hash = _hash(_first[i]);
+                hashes[i] = hash;
+                ++counts[(hash % _capacity) / region_size];
+            }
+        });
+
+        // Regions are laid out one after another, chunks in input order within each.
+        vector<size_type> region_start;
+        region_start.resize(parts + 1, size_type(0));
+
+        size_type total = 0;
+        for (size_type region = 0; region < parts; ++region) {
+            region_start[region] = total;
+
+            for (size_type chunk = 0; chunk < parts; ++chunk) {
+                size_type count = offsets[chunk * parts + region];
+                offsets[chunk * parts + region] = total;
+                total += count;
+            }
+        }
+        region_start[parts] = total;
+
+        vector<size_type> order;
+        order.resize(_count, default_init);
+
+        _pool.parallel_for(0, parts, 1, [&](size_type _chunk) {
+            size_type *next = offsets.data() + _chunk * parts;
+            size_type end = (_chunk + 1) * chunk_size < _count ? (_chunk + 1) * chunk_size : _count;
+
+            for (size_type i = _chunk * chunk_size; i < end; ++i) {
+                order[next[(hashes[i] % _capacity) / region_size]++] = i;
+            }
+        });
+
+        vector<vector<size_type>> deferred;
+        deferred.resize(parts);
+
+        _pool.parallel_for(0, parts, 1, [&](size_type _region) {
+            size_type region_end = (_region + 1) * region_size;
+
+            for (size_type pos = region_start[_region]; pos < region_start[_region + 1]; ++pos) {
+                size_type i = order[pos];
+                size_type hash = hashes[i];
+                size_type idx = hash % _capacity;
+
+                while (idx < region_end && _hdata[idx] && _hdata[idx] != hash) {
+                    ++idx;
+                }
+
+                if (idx == region_end) {
+                    deferred[_region].push_back(i);
+                    continue;
+                }
+
+                _place(idx, _first[i], _hdata[idx] != 0);
+                _hdata[idx] = hash;
+            }
+        });
+
+        for (size_type region = 0; region < parts; ++region) {
+            for (size_type i : deferred[region]) {
+                _insert(_first[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Grants the parallel builders access to the tables of set and map.
+     */
+    struct __parallel_hash_access {
+        /**
+         * @brief Replace the table of a container with an empty, zeroed one
+         * sized for _count elements.
+         *
+         * calloc hands out zeroed pages that the workers fault in themselves.
+         *
+         * @return The capacity of the new table, 0 if _count is 0.
+         */
+        template <typename _Tp>
+        static std::size_t __allocate(set<_Tp> &_set, std::size_t _count) {
+            _set.release();
+
+            std::size_t capacity = __capacity_for(_count);
+            if (capacity) {
+                _set._M_hdata = (std::size_t *) std::calloc(capacity, sizeof(std::size_t));
+                _set._M_vdata = (_Tp *) std::malloc(capacity * sizeof(_Tp));
+                _set._M_capacity = capacity;
+            }
+
+            return capacity;
+        }
+
+        template <typename _kTp, typename _vTp>
+        static std::size_t __allocate(map<_kTp, _vTp> &_map, std::size_t _count) {
+            _map.release();
+
+            std::size_t capacity = __capacity_for(_count);
+            if (capacity) {
+                _map._M_hdata = (std::size_t *) std::calloc(capacity, sizeof(std::size_t));
+                _map._M_kdata = (_kTp *) std::malloc(capacity * sizeof(_kTp));
+                _map._M_vdata = (_vTp *) std::malloc(capacity * sizeof(_vTp));
+                _map._M_capacity = capacity;
+            }
+
+            return capacity;
+        }
+
+        static std::size_t __capacity_for(std::size_t _count) {
+            if (_count == 0) {
+                return 0;
+            }
+
+            std::size_t capacity = 1;
+            while (capacity < 2 * _count) {
+                capacity *= 2;
+            }
+
+            return capacity;
+        }
+
+        template <typename _Tp>
+        static std::size_t *__hdata(set<_Tp> &_set) {
+            return _set._M_hdata;
+        }
+
+        template <typename _kTp, typename _vTp>
+        static std::size_t *__hdata(map<_kTp, _vTp> &_map) {
+            return _map._M_hdata;
+        }
+
+        template <typename _Tp>
+        static _Tp *__vdata(set<_Tp> &_set) {
+            return _set._M_vdata;
+        }
+
+        template <typename _kTp, typename _vTp>
+        static _kTp *__kdata(map<_kTp, _vTp> &_map) {
+            return _map._M_kdata;
+        }
+
+        template <typename _kTp, typename _vTp>
+        static _vTp *__vdata(map<_kTp, _vTp> &_map) {
+            return _map._M_vdata;
+        }
+    };
+
+    /**
+     * @brief Replace the contents of a set with a range, built in parallel.
+     *
+     * The table is sized for the whole range up front and filled by the
+     * workers of the pool, each owning a contiguous region of slots, so
+     * no rehashing or synchronisation happens during the build.
+     *
+     * @param _set The set to fill.
+     * @param _first The beginning of the range of values.
+     * @param _last The end of the range of values.
+     * @param _pool The pool whose workers build the table.
+     */
+    template <typename _Tp, typename _RandomIt>
+    void build_parallel(set<_Tp> &_set, _RandomIt _first, _RandomIt _last,
+            thread_pool &_pool = thread_pool::default_pool()) {
+        using size_type = std::size_t;
+
+        size_type count = size_type(_last - _first);
+        size_type capacity = __parallel_hash_access::__allocate(_set, count);
+        if (capacity == 0) {
+            return;
+        }
+
+        _Tp *vdata = __parallel_hash_access::__vdata(_set);
+
+        __parallel_hash_build(_first, count, __parallel_hash_access::__hdata(_set), capacity, _pool,
+            [](const _Tp &_value) {
+                return __fnv1hash(&_value, sizeof(_value));
+            },
+            [vdata](size_type _idx, const _Tp &_value, bool) {
+                vdata[_idx] = _value;
+            },
+            [&_set](const _Tp &_value) {
+                _set.insert(_value);
+            });
+    }
+
+    /**
+     * @brief Replace the contents of a map with a range of key-value pairs, built in
+     *        parallel, combining the values of repeated keys.
+     *
+     * The table is sized for the whole range up front and filled by the
+     * workers of the pool, each owning a contiguous region of slots, so
+     * no rehashing or synchronisation happens during the build. The values
+     * of a key are combined in input order, so the result matches a
+     * sequential left fold whenever the combine function is associative.
+     *
+     * @param _map The map to fill.
+     * @param _first The beginning of the range of pairs with `first` and `second` members.
+     * @param _last The end of the range of pairs.
+     * @param _combine Called as `_combine(accumulated, value)`; returns the combined value.
+     * @param _pool The pool whose workers build the table.
+     */
+    template <typename _kTp, typename _vTp, typename _RandomIt, typename _Combine>
+    void build_parallel(map<_kTp, _vTp> &_map, _RandomIt _first, _RandomIt _last, _Combine _combine,
+            thread_pool &_pool = thread_pool::default_pool()) {
+        using size_type = std::size_t;
+        using __element_type = decltype(*_first);
+
+        size_type count = size_type(_last - _first);
+        size_type capacity = __parallel_hash_access::__allocate(_map, count);
+        if (capacity == 0) {
+            return;
+        }
+
+        _kTp *kdata = __parallel_hash_access::__kdata(_map);
+        _vTp *vdata = __parallel_hash_access::__vdata(_map);
+
+        __parallel_hash_build(_first, count, __parallel_hash_access::__hdata(_map), capacity, _pool,
+            [](__element_type _pair) {
+                return __fnv1hash(&_pair.first, sizeof(_kTp));
+            },
+            [kdata, vdata, &_combine](size_type _idx, __element_type _pair, bool _occupied) {
+                if (_occupied) {
+                    vdata[_idx] = _combine(vdata[_idx], _pair.second);
+                }
+                else {
+                    kdata[_idx] = _pair.first;
+                    vdata[_idx] = _pair.second;
+                }
+            },
+            [&_map, &_combine](__element_type _pair) {
+                _vTp *value = _map.find(_pair.first);
+
+                if (value) {
+                    *value = _combine(*value, _pair.second);
+                }
+                else {
+                    _map.insert(_pair.first, _pair.second);
+                }
+            });
+    }
+
+    /**
+     * @brief Replace the contents of a map with a range of key-value pairs, built in parallel.
+     *
+     * As with map::insert(), a key that occurs several times keeps its last value.
+     *
+     * @param _map The map to fill.
+     * @param _first The beginning of the range of pairs with `first` and `second` members.
+     * @param _last The end of the range of pairs.
+     * @param _pool The pool whose workers build the table.
+     */
+    template <typename _kTp, typename _vTp, typename _RandomIt>
+    void build_parallel(map<_kTp, _vTp> &_map, _RandomIt _first, _RandomIt _last,
+            thread_pool &_pool = thread_pool::default_pool()) {
+        cppds::build_parallel(_map, _first, _last, [](const _vTp &, const _vTp &_value) {
+            return _value;
+        }, _pool);
+    }
+}
@@ -0,0 +1,326 @@
+/**
+ * @file parallel_sort.hpp
+ * @brief Parallel sample sort and parallel stable merge sort.
+ */
+
+#pragma once
+
+#include <algorithm>            ///< For std::upper_bound, std::merge and std::stable_sort
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For std::uint16_t and std::uint64_t
+#include <functional>           ///< For std::less
+#include <iterator>             ///< For std::iterator_traits and std::make_move_iterator
+#include <type_traits>          ///< For std::is_default_constructible
+#include <utility>              ///< For std::move
+
+#include "sort.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief Ranges smaller than this are sorted sequentially by the parallel sorts.
+     */
+    constexpr std::size_t __parallel_sort_threshold = std::size_t(1) << 16;
+
+    /**
+     * @brief Sort a range on the workers of a pool with parallel sample sort.
+     *
+     * A random sample of the input picks a few splitters per worker. Each
+     * chunk of the input is classified against them in parallel and the
+     * elements are scattered into a buffer bucket by bucket, each chunk
+     * writing its own slice of every bucket, so no synchronisation is needed.
+     * The buckets are then sorted with cppds::sort and moved back in
+     * parallel. Elements equal to a splitter get a bucket of their own that
+     * needs no sorting, so inputs with many duplicates stay balanced.
+     *
+     * Small ranges and single-worker pools fall back to cppds::sort. Not
+     * stable; uses a buffer as large as the range.
+     *
+     * @tparam _RandomIt A random access iterator whose value type is default
+     *         constructible, copyable and move assignable: the buffer is
+     *         default-initialized and elements are moved through it.
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     * @param _compare The strict weak ordering of the elements.
+     * @param _pool The pool whose workers sort the range.
+     */
+    template <typename _RandomIt, typename _Compare>
+    void parallel_sort(_RandomIt _first, _RandomIt _last, _Compare _compare,
+            thread_pool &_pool = thread_pool::default_pool()) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+        using size_type = std::size_t;
+
+        static_assert(std::is_default_constructible<value_type>::value,
+            "parallel_sort requires default constructible elements for its buffer");
+
+        size_type count = size_type(_last - _first);
+
+        if (count < __parallel_sort_threshold || _pool.size() < 2) {
+            cppds::sort(_first, _last, _compare);
+            return;
+        }
+
+        // Oversampling keeps the buckets within a small factor of their
+        // expected size with high probability.
+        constexpr size_type oversampling = 32;
+
+        size_type chunks = 4 * _pool.size();
+        size_type chunk_size = (count + chunks - 1) / chunks;
+
+        vector<value_type> samples;
+        samples.reserve(chunks * oversampling);
+
+        std::uint64_t state = count;
+        for (size_type i = 0; i < chunks * oversampling; ++i) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            samples.push_back(_first[size_type(state >> 16) % count]);
+        }
+
+        cppds::sort(samples.begin(), samples.end(), _compare);
+
+        vector<value_type> splitters;
+        splitters.reserve(chunks);
+
+        for (size_type i = 1; i < chunks; ++i) {
+            const value_type &sample = samples[i * oversampling];
+
+            if (splitters.empty() || _compare(splitters.back(), sample)) {
+                splitters.push_back(sample);
+            }
+        }
+
+        // Bucket 2 * i holds the elements between splitters i - 1 and i, and
+        // bucket 2 * i - 1 the elements equal to splitter i - 1.
+        size_type buckets = 2 * splitters.size() + 1;
+
+        auto bucket_of = [&](const value_type &_value) -> size_type {
+            size_type idx = size_type(std::upper_bound(splitters.begin(), splitters.end(), _value, _compare)
+                - splitters.begin());
+
+            if (idx > 0 && !_compare(splitters[idx - 1], _value)) {
+                return 2 * idx - 1;
+            }
+
+            return 2 * idx;
+        };
+
+        vector<std::uint16_t> ids;
+        ids.resize(count, default_init);
+
+        vector<size_type> offsets;
+        offsets.resize(chunks * buckets, size_type(0));
+
+        _pool.parallel_for(0, chunks, 1, [&](size_type _chunk) {
+            size_type *counts = offsets.data() + _chunk * buckets;
+            size_type begin = _chunk * chunk_size < count ? _chunk * chunk_size : count;
+            size_type end = begin + chunk_size < count ? begin + chunk_size : count;
+
+            for (size_type i = begin; i < end; ++i) {
+                size_type bucket = bucket_of(_first[i]);
+                ids[i] = std::uint16_t(bucket);
+                ++counts[bucket];
+            }
+        });
+
+        // Buckets are laid out one after another, chunks in order within each.
+        vector<size_type> bucket_start;
+        bucket_start.resize(buckets + 1, size_type(0));
+
+        size_type total = 0;
+        for (size_type bucket = 0; bucket < buckets; ++bucket) {
+            bucket_start[bucket] = total;
+
+            for (size_type chunk = 0; chunk < chunks; ++chunk) {
+                size_type bucket_count = offsets[chunk * buckets + bucket];
+                offsets[chunk * buckets + bucket] = total;
+                total += bucket_count;
+            }
+        }
+        bucket_start[buckets] = total;
+
+        vector<value_type> buffer;
+        buffer.resize(count, default_init);
+
+        _pool.parallel_for(0, chunks, 1, [&](size_type _chunk) {
+            size_type *next = offsets.data() + _chunk * buckets;
+            size_type begin = _chunk * chunk_size < count ? _chunk * chunk_size : count;
+            size_type end = begin + chunk_size < count ? begin + chunk_size : count;
+
+            for (size_type i = begin; i < end; ++i) {
+                buffer[next[ids[i]]++] = std::move(_first[i]);
+            }
+        });
+
+        _pool.parallel_for(0, buckets, 1, [&](size_type _bucket) {
+            value_type *begin = buffer.data() + bucket_start[_bucket];
+            value_type *end = buffer.data() + bucket_start[_bucket + 1];
+
+            if (_bucket % 2 == 0) {
+                cppds::sort(begin, end, _compare);
+            }
+
+            _RandomIt out = _first + (begin - buffer.data());
+            for (value_type *it = begin; it != end; ++it) {
+                *out++ = std::move(*it);
+            }
+        });
+    }
+
+    /**
+     * @brief Sort a range in ascending order with parallel sample sort.
+     *
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     */
+    template <typename _RandomIt>
+    void parallel_sort(_RandomIt _first, _RandomIt _last) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        cppds::parallel_sort(_first, _last, std::less<value_type>());
+    }
+
+    /**
+     * @brief Find how many elements of _a are among the first _k of the stable merge of _a and _b.
+     *
+     * Elements of _a precede equal elements of _b.
+     */
+    template <typename _It, typename _Compare>
+    std::size_t __parallel_merge_split(_It _a, std::size_t _na, _It _b, std::size_t _nb, std::size_t _k, _Compare &_compare) {
+        std::size_t lo = _k > _nb ? _k - _nb : 0;
+        std::size_t hi = _k < _na ? _k : _na;
+
+        while (lo < hi) {
+            std::size_t i = lo + (hi - lo) / 2;
+            std::size_t j = _k - i;
+
+            // _a[i] is among the first _k if it precedes _b[j - 1].
+            if (j > 0 && !_compare(_b[j - 1], _a[i])) {
+                lo = i + 1;
+            }
+            else {
+                hi = i;
+            }
+        }
+
+        return lo;
+    }
+
+    /**
+     * @brief Stable sort a range on the workers of a pool with parallel merge sort.
+     *
+     * The range is cut into one run per worker, rounded up to a power of
+     * two, and the runs are stable sorted in parallel. Pairs of runs are then
+     * merged round by round between the range and a buffer; every merge is
+     * split into independent pieces at the positions where the merged output
+     * would be cut evenly, so all workers take part in every round.
+     *
+     * Small ranges and single-worker pools fall back to std::stable_sort.
+     * Uses a buffer as large as the range.
+     *
+     * @tparam _RandomIt A random access iterator whose value type is default
+     *         constructible and move assignable: the buffer is
+     *         default-initialized and elements are moved through it.
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     * @param _compare The strict weak ordering of the elements.
+     * @param _pool The pool whose workers sort the range.
+     */
+    template <typename _RandomIt, typename _Compare>
+    void parallel_stable_sort(_RandomIt _first, _RandomIt _last, _Compare _compare,
+            thread_pool &_pool = thread_pool::default_pool()) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+        using size_type = std::size_t;
+
+        static_assert(std::is_default_constructible<value_type>::value,
+            "parallel_stable_sort requires default constructible elements for its buffer");
+
+        size_type count = size_type(_last - _first);
+
+        if (count < __parallel_sort_threshold || _pool.size() < 2) {
+            std::stable_sort(_first, _last, _compare);
+            return;
+        }
+
+        size_type runs = 1;
+        while (runs < _pool.size()) {
+            runs *= 2;
+        }
+
+        auto run_begin = [&](size_type _run) {
+            return _run * count / runs;
+        };
+
+        _pool.parallel_for(0, runs, 1, [&](size_type _run) {
+            std::stable_sort(_first + run_begin(_run), _first + run_begin(_run + 1), _compare);
+        });
+
+        vector<value_type> buffer;
+        buffer.resize(count, default_init);
+
+        // Each round merges pairs of runs of the source into the destination.
+        auto merge_round = [&](auto _src, auto _dst, size_type _width) {
+            size_type merges = runs / (2 * _width);
+            size_type pieces = (4 * _pool.size() + merges - 1) / merges;
+
+            _pool.parallel_for(0, merges * pieces, 1, [&](size_type _task) {
+                size_type merge = _task / pieces;
+                size_type piece = _task % pieces;
+
+                size_type begin = run_begin(2 * merge * _width);
+                size_type middle = run_begin((2 * merge + 1) * _width);
+                size_type end = run_begin((2 * merge + 2) * _width);
+
+                size_type na = middle - begin;
+                size_type nb = end - middle;
+
+                size_type k_lo = piece * (na + nb) / pieces;
+                size_type k_hi = (piece + 1) * (na + nb) / pieces;
+
+                size_type i_lo = __parallel_merge_split(_src + begin, na, _src + middle, nb, k_lo, _compare);
+                size_type i_hi = __parallel_merge_split(_src + begin, na, _src + middle, nb, k_hi, _compare);
+
+                std::merge(std::make_move_iterator(_src + begin + i_lo),
+                    std::make_move_iterator(_src + begin + i_hi),
+                    std::make_move_iterator(_src + middle + (k_lo - i_lo)),
+                    std::make_move_iterator(_src + middle + (k_hi - i_hi)),
+                    _dst + begin + k_lo, _compare);
+            });
+        };
+
+        bool in_buffer = false;
+
+        for (size_type width = 1; width < runs; width *= 2) {
+            if (in_buffer) {
+                merge_round(buffer.data(), _first, width);
+            }
+            else {
+                merge_round(_first, buffer.data(), width);
+            }
+
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer) {
+            value_type *data = buffer.data();
+
+            _pool.parallel_for(0, count, 0, [&](size_type i) {
+                _first[i] = std::move(data[i]);
+            });
+        }
+    }
+
+    /**
+     * @brief Stable sort a range in ascending order with parallel merge sort.
+     *
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     */
+    template <typename _RandomIt>
+    void parallel_stable_sort(_RandomIt _first, _RandomIt _last) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        cppds::parallel_stable_sort(_first, _last, std::less<value_type>());
+    }
+}
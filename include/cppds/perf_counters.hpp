@@ -0,0 +1,244 @@
+/**
+ * @file perf_counters.hpp
+ * @brief Hardware performance counters read through Linux perf_event_open.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For std::uint64_t
+
+#if defined(__linux__)
+#include <linux/perf_event.h>   ///< For perf_event_attr and the event constants
+#include <sys/ioctl.h>          ///< For ioctl
+#include <sys/syscall.h>        ///< For SYS_perf_event_open
+#include <unistd.h>             ///< For syscall, read and close
+#include <cstring>              ///< For std::memset
+#endif
+
+namespace cppds {
+
+    /**
+     * @brief A set of hardware performance counters for the constructing
+     * thread and the threads it creates afterwards.
+     *
+     * Counts cycles, instructions, L1 data cache misses, last-level cache
+     * misses, branch misses and data TLB misses in user space between start()
+     * and stop(). The counts include the threads the constructing thread
+     * creates after the counters, so a thread pool must be created after them
+     * to be counted; threads that already exist are not. Values accumulate
+     * over several start/stop pairs until reset(). Each event is opened
+     * separately, so an event the CPU or kernel does not provide is simply
+     * unavailable; on other platforms, or when perf_event_open is not
+     * permitted, every event is unavailable and all operations are no-ops.
+     */
+    class perf_counters {
+    public:
+        using value_type = std::uint64_t;   ///< The type of counter values.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /**
+         * @brief The hardware events being counted.
+         */
+        enum event {
+            cycles,
+            instructions,
+            l1d_misses,
+            llc_misses,
+            branch_misses,
+            dtlb_misses,
+            event_count,
+        };
+
+        /**
+         * @brief Constructor. Opens the counters, initially stopped.
+         */
+        perf_counters() {
+#if defined(__linux__)
+            for (size_type i = 0; i < event_count; ++i) {
+                _M_fds[i] = __open(event(i));
+            }
+#endif
+        }
+
+        perf_counters(const perf_counters &) = delete;
+        perf_counters &operator=(const perf_counters &) = delete;
+
+        /**
+         * @brief Destructor. Closes the counters.
+         */
+        ~perf_counters() {
+#if defined(__linux__)
+            for (int fd : _M_fds) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+            }
+#endif
+        }
+
+        /**
+         * @brief Get the name of an event.
+         *
+         * @param _event The event.
+         * @return A short, stable name suitable as a report key.
+         */
+        static const char *name(event _event) {
+            static const char *const names[event_count] = {
+                "cycles", "instructions", "l1d_misses",
+                "llc_misses", "branch_misses", "dtlb_misses",
+            };
+            return names[_event];
+        }
+
+        /**
+         * @brief Check whether any event could be opened.
+         *
+         * @return True if at least one counter is available.
+         */
+        bool available() const {
+            for (size_type i = 0; i < event_count; ++i) {
+                if (available(event(i))) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Check whether an event could be opened.
+         *
+         * @param _event The event.
+         * @return True if the event is counted.
+         */
+        bool available(event _event) const {
+            return _M_fds[_event] >= 0;
+        }
+
+        /**
+         * @brief Start counting.
+         */
+        void start() {
+#if defined(__linux__)
+            for (size_type i = 0; i < event_count; ++i) {
+                if (_M_fds[i] >= 0) {
+                    __read(i, _M_start[i]);
+                    ioctl(_M_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        /**
+         * @brief Stop counting and accumulate the counts since start().
+         */
+        void stop() {
+#if defined(__linux__)
+            for (size_type i = 0; i < event_count; ++i) {
+                if (_M_fds[i] >= 0) {
+                    ioctl(_M_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+                    __reading now;
+                    __read(i, now);
+
+                    value_type running = now.running - _M_start[i].running;
+                    value_type enabled = now.enabled - _M_start[i].enabled;
+                    value_type count = now.value - _M_start[i].value;
+
+                    // Scale up when the kernel multiplexed the counter.
+                    if (running && running < enabled) {
+                        count = value_type(double(count) * double(enabled) / double(running));
+                    }
+
+                    _M_values[i] += count;
+                }
+            }
+#endif
+        }
+
+        /**
+         * @brief Reset the accumulated counts to zero.
+         */
+        void reset() {
+            for (value_type &value : _M_values) {
+                value = 0;
+            }
+        }
+
+        /**
+         * @brief Get the accumulated count of an event.
+         *
+         * @param _event The event.
+         * @return The count, or 0 if the event is unavailable.
+         */
+        value_type value(event _event) const {
+            return _M_values[_event];
+        }
+
+    protected:
+        struct __reading {
+            value_type value {};
+            value_type enabled {};
+            value_type running {};
+        };
+
+#if defined(__linux__)
+        static int __open(event _event) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+
+            attr.size = sizeof(attr);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.inherit = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            const value_type read_miss =
+                (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+            switch (_event) {
+            case cycles:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case instructions:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case l1d_misses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+                break;
+            case llc_misses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_LL | read_miss;
+                break;
+            case branch_misses:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            case dtlb_misses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_DTLB | read_miss;
+                break;
+            default:
+                return -1;
+            }
+
+            return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+
+        void __read(size_type _index, __reading &_reading) const {
+            if (::read(_M_fds[_index], &_reading, sizeof(_reading)) != sizeof(_reading)) {
+                _reading = __reading();
+            }
+        }
+#endif
+
+        int _M_fds[event_count] = {-1, -1, -1, -1, -1, -1};     ///< The counter file descriptors, -1 if unavailable.
+        __reading _M_start[event_count] {};                     ///< The readings taken by start().
+        value_type _M_values[event_count] {};                   ///< The accumulated counts.
+    };
+
+} // namespace cppds
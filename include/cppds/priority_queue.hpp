@@ -0,0 +1,339 @@
+/**
+ * @file priority_queue.hpp
+ * @brief A d-ary heap priority queue stored in a contiguous vector.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <functional>           ///< For std::less
+#include <initializer_list>     ///< For std::initializer_list
+#include <utility>              ///< For std::move
+
+#include "sort.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A priority queue implemented as an implicit d-ary heap.
+     *
+     * The heap is stored level by level in a single cppds::vector, and the
+     * children of the element at index i are at i * _Arity + 1 onwards. With
+     * the default arity of 4 all children of a node share a cache line for
+     * small elements and the heap is half as deep as a binary heap, so
+     * pops take fewer dependent cache misses at large sizes for a few more
+     * comparisons per level.
+     *
+     * As with std::priority_queue, top() is the greatest element according
+     * to _Compare; use std::greater for a min-queue.
+     *
+     * @tparam _Tp The type of elements stored in the queue.
+     * @tparam _Compare The strict weak ordering of the elements.
+     * @tparam _Arity The number of children of each heap node, at least 2.
+     */
+    template <typename _Tp, typename _Compare = std::less<_Tp>, std::size_t _Arity = 4>
+    class priority_queue {
+        static_assert(_Arity >= 2, "a heap needs at least two children per node");
+
+    public:
+        using value_type = _Tp;                 ///< The type of elements stored in the queue.
+        using size_type = std::size_t;          ///< The type used for size-related operations.
+        using value_compare = _Compare;         ///< The ordering of the elements.
+
+        static constexpr size_type arity = _Arity;  ///< The number of children of each heap node.
+
+        /**
+         * @brief Default constructor.
+         */
+        priority_queue() = default;
+
+        /**
+         * @brief Constructor with a custom comparison.
+         *
+         * @param _compare The ordering of the elements.
+         */
+        explicit priority_queue(const value_compare &_compare) : _M_compare(_compare) {}
+
+        /**
+         * @brief Constructor that builds the queue from an iterator range in O(n).
+         *
+         * @param _first The beginning of the range of values.
+         * @param _last The end of the range of values.
+         * @param _compare The ordering of the elements.
+         */
+        template <typename _InputIt>
+        priority_queue(_InputIt _first, _InputIt _last, const value_compare &_compare = value_compare())
+            : _M_compare(_compare) {
+            heapify(_first, _last);
+        }
+
+        /**
+         * @brief Constructor that builds the queue from an initializer list.
+         *
+         * @param _list An initializer list of values.
+         */
+        priority_queue(const std::initializer_list<value_type> &_list) {
+            heapify(_list.begin(), _list.end());
+        }
+
+        /**
+         * @brief Replace the contents with a range of values in O(n).
+         *
+         * The values are copied unordered and the heap is built bottom-up,
+         * which is linear rather than the O(n log n) of pushing one by one.
+         *
+         * @param _first The beginning of the range of values.
+         * @param _last The end of the range of values.
+         */
+        template <typename _InputIt>
+        void heapify(_InputIt _first, _InputIt _last) {
+            this->_M_heap.assign(_first, _last);
+            __make_heap();
+        }
+
+        /**
+         * @brief Add a value to the queue.
+         *
+         * @param _value The value to add.
+         */
+        void push(const value_type &_value) {
+            this->_M_heap.push_back(_value);
+            __sift_up(this->size() - 1, std::move(this->_M_heap.back()));
+        }
+
+        /**
+         * @brief Remove the greatest element from the queue.
+         *
+         * The queue must not be empty.
+         */
+        void pop() {
+            value_type last = std::move(this->_M_heap.back());
+            this->_M_heap.pop_back();
+
+            if (!this->empty()) {
+                __pop_into_root(std::move(last));
+            }
+        }
+
+        /**
+         * @brief Access the greatest element of the queue.
+         *
+         * The queue must not be empty.
+         *
+         * @return A const reference to the greatest element.
+         */
+        const value_type &top() const {
+            return this->_M_heap[0];
+        }
+
+        /**
+         * @brief Push a value, then pop and return the greatest element.
+         *
+         * This is one sift instead of two, and none at all when the value
+         * would be popped straight away.
+         *
+         * @param _value The value to add.
+         * @return The greatest of _value and the elements in the queue.
+         */
+        value_type push_pop(const value_type &_value) {
+            if (this->empty() || !_M_compare(_value, this->_M_heap[0])) {
+                return _value;
+            }
+
+            value_type result = std::move(this->_M_heap[0]);
+            __sift_down(0, value_type(_value));
+
+            return result;
+        }
+
+        /**
+         * @brief Pop the greatest element, then push a value, in one sift.
+         *
+         * The queue must not be empty. Unlike push_pop, the returned element
+         * is always one that was in the queue, even if _value is greater.
+         *
+         * @param _value The value to add.
+         * @return The element that was at the top.
+         */
+        value_type replace_top(const value_type &_value) {
+            value_type result = std::move(this->_M_heap[0]);
+            __sift_down(0, value_type(_value));
+
+            return result;
+        }
+
+        /**
+         * @brief Pop up to a number of elements in priority order.
+         *
+         * Draining the whole queue sorts the storage in place instead of
+         * sifting once per element.
+         *
+         * @param _count The maximum number of elements to pop.
+         * @param _out The output iterator receiving the elements, greatest first.
+         * @return The output iterator past the last element written.
+         */
+        template <typename _OutputIt>
+        _OutputIt pop_n(size_type _count, _OutputIt _out) {
+            if (_count >= this->size()) {
+                value_type *data = this->_M_heap.data();
+
+                cppds::sort(data, data + this->size(), [this](const value_type &_a, const value_type &_b) {
+                    return _M_compare(_b, _a);
+                });
+
+                for (size_type i = 0; i < this->size(); ++i) {
+                    *_out++ = std::move(data[i]);
+                }
+
+                this->_M_heap.clear();
+
+                return _out;
+            }
+
+            for (; _count > 0; --_count) {
+                *_out++ = std::move(this->_M_heap[0]);
+                this->pop();
+            }
+
+            return _out;
+        }
+
+        /**
+         * @brief Reserve space for a number of elements.
+         *
+         * @param _capacity The number of elements.
+         */
+        void reserve(size_type _capacity) {
+            this->_M_heap.reserve(_capacity);
+        }
+
+        /**
+         * @brief Remove all elements, keeping the storage.
+         */
+        void clear() {
+            this->_M_heap.clear();
+        }
+
+        /**
+         * @brief Get the size of the queue.
+         *
+         * @return The number of elements in the queue.
+         */
+        size_type size() const {
+            return this->_M_heap.size();
+        }
+
+        /**
+         * @brief Check if the queue is empty.
+         *
+         * @return `true` if the queue is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_heap.empty();
+        }
+
+    protected:
+        static size_type __parent(size_type _index) {
+            return (_index - 1) / _Arity;
+        }
+
+        static size_type __first_child(size_type _index) {
+            return _index * _Arity + 1;
+        }
+
+        /**
+         * @brief Find the greatest child of a node that has at least one.
+         */
+        size_type __best_child(size_type _index) const {
+            const value_type *heap = this->_M_heap.data();
+            size_type first = __first_child(_index);
+            size_type best = first;
+
+            if (first + _Arity <= this->size()) {
+                // A full set of children; the constant trip count unrolls.
+                for (size_type i = 1; i < _Arity; ++i) {
+                    if (_M_compare(heap[best], heap[first + i])) {
+                        best = first + i;
+                    }
+                }
+            } else {
+                for (size_type i = first + 1; i < this->size(); ++i) {
+                    if (_M_compare(heap[best], heap[i])) {
+                        best = i;
+                    }
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Move a value up from a hole at _index to its place.
+         */
+        void __sift_up(size_type _index, value_type _value) {
+            while (_index > 0) {
+                size_type parent = __parent(_index);
+
+                if (!_M_compare(this->_M_heap[parent], _value)) {
+                    break;
+                }
+
+                this->_M_heap[_index] = std::move(this->_M_heap[parent]);
+                _index = parent;
+            }
+
+            this->_M_heap[_index] = std::move(_value);
+        }
+
+        /**
+         * @brief Move a value down from a hole at _index to its place.
+         */
+        void __sift_down(size_type _index, value_type _value) {
+            while (__first_child(_index) < this->size()) {
+                size_type child = __best_child(_index);
+
+                if (!_M_compare(_value, this->_M_heap[child])) {
+                    break;
+                }
+
+                this->_M_heap[_index] = std::move(this->_M_heap[child]);
+                _index = child;
+            }
+
+            this->_M_heap[_index] = std::move(_value);
+        }
+
+        /**
+         * @brief Fill the root hole left by a pop with the former last element.
+         *
+         * The last element almost always belongs near the bottom, so the hole
+         * is first walked down to a leaf without comparing against the value
+         * and the value is then sifted up, which saves a comparison per level.
+         */
+        void __pop_into_root(value_type _value) {
+            size_type index = 0;
+
+            while (__first_child(index) < this->size()) {
+                size_type child = __best_child(index);
+                this->_M_heap[index] = std::move(this->_M_heap[child]);
+                index = child;
+            }
+
+            __sift_up(index, std::move(_value));
+        }
+
+        void __make_heap() {
+            if (this->size() < 2) {
+                return;
+            }
+
+            for (size_type i = __parent(this->size() - 1) + 1; i-- > 0;) {
+                __sift_down(i, std::move(this->_M_heap[i]));
+            }
+        }
+
+        vector<value_type> _M_heap {};      // The heap, level by level
+        _Compare _M_compare {};             // The ordering of the elements
+    };
+}
@@ -0,0 +1,221 @@
+/**
+ * @file radix_heap.hpp
+ * @brief A monotone priority queue for unsigned integer keys.
+ */
+
+#pragma once
+
+#include <climits>              ///< For CHAR_BIT
+#include <cstddef>              ///< For std::size_t
+#include <type_traits>          ///< For std::is_integral and std::is_unsigned
+#include <utility>              ///< For std::move
+
+#include "array.hpp"
+#include "pair.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A monotone min-priority queue of unsigned integer keys with values.
+     *
+     * Keys are bucketed by the highest bit in which they differ from the
+     * last key taken from the top: bucket 0 holds keys equal to it and
+     * bucket b holds keys whose highest differing bit is b - 1. When bucket
+     * 0 runs empty the first non-empty bucket is redistributed around its
+     * smallest key, and every key it holds moves to a strictly lower
+     * bucket, so each element is moved at most once per key bit and push
+     * and pop are amortized O(1) for a fixed key width. Buckets are
+     * cppds::vectors that keep their storage, so a steady workload stops
+     * allocating.
+     *
+     * The queue is monotone: a pushed key must not be less than last_key(),
+     * the last key returned by top() or removed by pop(), as with event
+     * times in a discrete-event simulation or distances in Dijkstra's
+     * algorithm with non-negative weights. Buckets are redistributed lazily
+     * by top() and pop(), so pushes between a pop and the next top() may
+     * use any key from the popped one upwards.
+     *
+     * @tparam _Key The unsigned integer type of keys.
+     * @tparam _Value The type of values stored with the keys.
+     */
+    template <typename _Key, typename _Value>
+    class radix_heap {
+        static_assert(std::is_integral<_Key>::value && std::is_unsigned<_Key>::value,
+            "radix_heap keys must be unsigned integers");
+
+    public:
+        using key_type = _Key;                          ///< The type of keys.
+        using mapped_type = _Value;                     ///< The type of values.
+        using value_type = pair<_Key, _Value>;          ///< A key and its value.
+        using size_type = std::size_t;                  ///< The type used for size-related operations.
+
+        /**
+         * @brief Default constructor.
+         */
+        radix_heap() = default;
+
+        /**
+         * @brief Add a key and its value.
+         *
+         * The key must not be less than last_key().
+         *
+         * @param _key The key.
+         * @param _value The value.
+         */
+        void push(const key_type &_key, const mapped_type &_value) {
+            this->_M_buckets[__bucket(_key)].push_back(value_type(_key, _value));
+            ++this->_M_size;
+        }
+
+        /**
+         * @brief Remove an entry with the smallest key.
+         *
+         * The heap must not be empty. Entries with equal keys are popped in
+         * no particular order.
+         */
+        void pop() {
+            __refill();
+            this->_M_buckets[0].pop_back();
+            --this->_M_size;
+        }
+
+        /**
+         * @brief Get the smallest key.
+         *
+         * The heap must not be empty.
+         *
+         * @return The smallest key.
+         */
+        key_type top() const {
+            __refill();
+            return this->_M_last;
+        }
+
+        /**
+         * @brief Access the value of an entry with the smallest key.
+         *
+         * The heap must not be empty.
+         *
+         * @return A reference to the value that pop() removes next.
+         */
+        mapped_type &top_value() {
+            __refill();
+            return this->_M_buckets[0].back().second;
+        }
+
+        /**
+         * @brief Access the value of an entry with the smallest key.
+         *
+         * The heap must not be empty.
+         *
+         * @return A const reference to the value that pop() removes next.
+         */
+        const mapped_type &top_value() const {
+            __refill();
+            return this->_M_buckets[0].back().second;
+        }
+
+        /**
+         * @brief Get the smallest key that may still be pushed.
+         *
+         * @return The key last returned by top() or removed by pop(), or 0.
+         */
+        key_type last_key() const {
+            return this->_M_last;
+        }
+
+        /**
+         * @brief Remove all entries, keeping the bucket storage.
+         *
+         * The heap becomes unconstrained again: any key may be pushed next.
+         */
+        void clear() {
+            for (size_type i = 0; i < __bucket_count; ++i) {
+                this->_M_buckets[i].clear();
+            }
+
+            this->_M_size = 0;
+            this->_M_last = 0;
+        }
+
+        /**
+         * @brief Get the number of entries.
+         *
+         * @return The number of entries in the heap.
+         */
+        size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Check if the heap is empty.
+         *
+         * @return `true` if the heap is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_size == 0;
+        }
+
+    protected:
+        static constexpr size_type __key_bits = sizeof(key_type) * CHAR_BIT;
+        static constexpr size_type __bucket_count = __key_bits + 1;
+
+        /**
+         * @brief The bucket of a key: 0 if it equals the last key, else one
+         * past the index of the highest bit in which they differ.
+         */
+        size_type __bucket(key_type _key) const {
+            key_type diff = _key ^ this->_M_last;
+
+            if (diff == 0) {
+                return 0;
+            }
+
+            if constexpr (sizeof(key_type) <= sizeof(unsigned int)) {
+                return sizeof(unsigned int) * CHAR_BIT - __builtin_clz((unsigned int) diff);
+            } else {
+                return sizeof(unsigned long long) * CHAR_BIT - __builtin_clzll((unsigned long long) diff);
+            }
+        }
+
+        /**
+         * @brief If bucket 0 is empty, redistribute the first non-empty
+         * bucket around its smallest key. The heap must not be empty.
+         */
+        void __refill() const {
+            if (!this->_M_buckets[0].empty()) {
+                return;
+            }
+
+            size_type source = 1;
+            while (this->_M_buckets[source].empty()) {
+                ++source;
+            }
+
+            vector<value_type> &bucket = this->_M_buckets[source];
+
+            key_type smallest = bucket[0].first;
+            for (size_type i = 1; i < bucket.size(); ++i) {
+                if (bucket[i].first < smallest) {
+                    smallest = bucket[i].first;
+                }
+            }
+
+            // All keys in the bucket share the bits above source - 1 with
+            // the new last key, so each lands in a lower bucket.
+            this->_M_last = smallest;
+
+            for (size_type i = 0; i < bucket.size(); ++i) {
+                this->_M_buckets[__bucket(bucket[i].first)].push_back(std::move(bucket[i]));
+            }
+
+            bucket.clear();
+        }
+
+        // Redistribution is not observable, so top() may do it on a const heap.
+        mutable array<vector<value_type>, __bucket_count> _M_buckets {};   // Entries by highest differing bit
+        size_type _M_size = 0;                                              // The number of entries
+        mutable key_type _M_last = 0;                                       // The key of the last top() or pop()
+    };
+}
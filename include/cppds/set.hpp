@@ -9,10 +9,14 @@
 #include <cstdlib>
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "hash.hpp" // Include necessary header(s)
 
 namespace cppds {
+    struct __parallel_hash_access;
+
     /**
      * @brief A custom set data structure.
      *
@@ -88,7 +92,7 @@ namespace cppds {
          * @brief Destructor to clean up the set.
          */
         ~set() {
-            this->clear();
+            this->release();
         }
 
         /**
@@ -169,11 +173,34 @@ namespace cppds {
 
         /**
          * @brief Clear the set, removing all elements.
+         *
+         * The slot arrays are kept for reuse: only the hash array is reset,
+         * and slots are not visited at all when the elements are trivially
+         * destructible. Call release() or shrink_to_fit() to return the memory.
          */
         void clear() {
-            for (size_type i = 0; i < this->capacity(); ++i) {
-                if (this->_M_hdata[i]) {
-                    this->_M_vdata[i].~value_type();
+            if constexpr (!std::is_trivially_destructible<value_type>::value) {
+                for (size_type i = 0; i < this->capacity(); ++i) {
+                    if (this->_M_hdata[i]) {
+                        this->_M_vdata[i].~value_type();
+                    }
+                }
+            }
+
+            if (this->capacity()) {
+                std::memset(this->_M_hdata, 0, this->capacity() * sizeof(size_type));
+            }
+        }
+
+        /**
+         * @brief Clear the set and free its storage.
+         */
+        void release() {
+            if constexpr (!std::is_trivially_destructible<value_type>::value) {
+                for (size_type i = 0; i < this->capacity(); ++i) {
+                    if (this->_M_hdata[i]) {
+                        this->_M_vdata[i].~value_type();
+                    }
                 }
             }
 
@@ -186,6 +213,49 @@ namespace cppds {
             this->_M_vdata = nullptr;
         }
 
+        /**
+         * @brief Reduce the capacity to the smallest that holds the elements.
+         */
+        void shrink_to_fit() {
+            if (this->empty()) {
+                this->release();
+                return;
+            }
+
+            set other;
+
+            other.reserve(this->size());
+
+            for (size_type i = 0; i < this->capacity(); ++i) {
+                if (this->_M_hdata[i]) {
+                    other.insert(this->_M_vdata[i]);
+                }
+            }
+
+            if (other.capacity() < this->capacity()) {
+#ifdef CPPDS_HASH_STATS
+                // The rebuild counts as one more rehash of this table.
+                other._M_rehash_stats.count += this->_M_rehash_stats.count;
+                other._M_rehash_stats.nanoseconds += this->_M_rehash_stats.nanoseconds;
+#endif
+                this->swap(other);
+            }
+        }
+
+        /**
+         * @brief Exchange the contents of two sets without copying.
+         *
+         * @param _other The set to swap with.
+         */
+        void swap(set &_other) {
+            std::swap(this->_M_hdata, _other._M_hdata);
+            std::swap(this->_M_vdata, _other._M_vdata);
+            std::swap(this->_M_capacity, _other._M_capacity);
+#ifdef CPPDS_HASH_STATS
+            std::swap(this->_M_rehash_stats, _other._M_rehash_stats);
+#endif
+        }
+
         /**
          * @brief Get the size of the set.
          *
@@ -212,7 +282,23 @@ namespace cppds {
             return this->size() == 0;
         }
 
+#ifdef CPPDS_HASH_STATS
+        /**
+         * @brief Get occupancy and probing statistics of the set.
+         *
+         * Scans the whole table; only available when CPPDS_HASH_STATS is defined.
+         *
+         * @return The statistics.
+         */
+        hash_stats stats() const {
+            return __collect_hash_stats(this->_M_hdata, this->capacity(),
+                sizeof(size_type) + sizeof(value_type), this->_M_rehash_stats);
+        }
+#endif
+
     protected:
+        friend struct __parallel_hash_access;
+
         /**
          * @brief Get the current capacity of the set.
          *
@@ -232,6 +318,10 @@ namespace cppds {
                 return;
             }
 
+#ifdef CPPDS_HASH_STATS
+            __rehash_timer timer(this->_M_rehash_stats);
+#endif
+
             size_type old_capacity = this->capacity();
 
             this->_M_capacity = _capacity;
@@ -256,5 +346,9 @@ namespace cppds {
         size_type *_M_hdata {}; // Array to store hash values
         value_type *_M_vdata {}; // Array to store values
         size_type _M_capacity {}; // Current capacity of the set
+
+#ifdef CPPDS_HASH_STATS
+        __rehash_stats _M_rehash_stats {}; // Rehash counters for stats()
+#endif
     };
 }
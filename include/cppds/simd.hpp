@@ -0,0 +1,347 @@
+/**
+ * @file simd.hpp
+ * @brief Comparison predicates and vectorized kernels shared by the containers.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For fixed-width integer types
+#include <type_traits>          ///< For std::is_arithmetic and std::is_same
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace cppds {
+
+    /**
+     * @brief Comparison operators understood by the vectorized kernels.
+     */
+    enum class compare {
+        less,
+        less_equal,
+        greater,
+        greater_equal,
+        equal,
+        not_equal,
+    };
+
+    /**
+     * @brief A predicate comparing an element against a fixed value.
+     *
+     * Containers recognize this predicate and may evaluate it on several
+     * elements at once, e.g. `v.erase_if(cppds::less_than(0.5f))`.
+     *
+     * @tparam _Tp The type of the compared elements.
+     * @tparam _Op The comparison operator, applied as `element _Op value`.
+     */
+    template <typename _Tp, compare _Op>
+    struct compare_with {
+        using value_type = _Tp;
+
+        static constexpr compare op = _Op;
+
+        _Tp value {};   ///< The value elements are compared against.
+
+        /**
+         * @brief Evaluate the predicate.
+         *
+         * @param _element The element to compare.
+         * @return The result of `_element _Op value`.
+         */
+        constexpr bool operator()(const _Tp &_element) const {
+            switch (_Op) {
+            case compare::less: return _element < value;
+            case compare::less_equal: return _element <= value;
+            case compare::greater: return _element > value;
+            case compare::greater_equal: return _element >= value;
+            case compare::equal: return _element == value;
+            case compare::not_equal: return _element != value;
+            }
+            return false;
+        }
+    };
+
+    template <typename _Tp>
+    constexpr compare_with<_Tp, compare::less> less_than(const _Tp &_value) {
+        return {_value};
+    }
+
+    template <typename _Tp>
+    constexpr compare_with<_Tp, compare::less_equal> less_equal(const _Tp &_value) {
+        return {_value};
+    }
+
+    template <typename _Tp>
+    constexpr compare_with<_Tp, compare::greater> greater_than(const _Tp &_value) {
+        return {_value};
+    }
+
+    template <typename _Tp>
+    constexpr compare_with<_Tp, compare::greater_equal> greater_equal(const _Tp &_value) {
+        return {_value};
+    }
+
+    template <typename _Tp>
+    constexpr compare_with<_Tp, compare::equal> equal_to(const _Tp &_value) {
+        return {_value};
+    }
+
+    template <typename _Tp>
+    constexpr compare_with<_Tp, compare::not_equal> not_equal_to(const _Tp &_value) {
+        return {_value};
+    }
+
+    template <typename _Pred>
+    struct __is_compare_with : std::false_type {};
+
+    template <typename _Tp, compare _Op>
+    struct __is_compare_with<compare_with<_Tp, _Op>> : std::true_type {};
+
+    /**
+     * @brief Whether a predicate on elements of type _Tp has a vectorized kernel.
+     */
+    template <typename _Pred, typename _Tp>
+    struct __is_simd_predicate : std::false_type {};
+
+    template <typename _Tp, compare _Op>
+    struct __is_simd_predicate<compare_with<_Tp, _Op>, _Tp> : std::is_arithmetic<_Tp> {};
+
+#if defined(__AVX2__)
+    /**
+     * @brief Lane permutations that pack the selected lanes of an 8-lane
+     * vector to the front, indexed by the 8-bit selection mask.
+     */
+    struct __compact_table {
+        std::uint64_t _M_indices[256];
+
+        constexpr __compact_table() : _M_indices {} {
+            for (unsigned mask = 0; mask < 256; ++mask) {
+                std::uint64_t packed = 0;
+                unsigned count = 0;
+                for (unsigned lane = 0; lane < 8; ++lane) {
+                    if (mask & (1u << lane)) {
+                        packed |= std::uint64_t(lane) << (8 * count++);
+                    }
+                }
+                _M_indices[mask] = packed;
+            }
+        }
+    };
+
+    inline constexpr __compact_table __compact_lut {};
+
+    /**
+     * @brief Evaluate a comparison on 8 lanes of 32-bit elements.
+     *
+     * @return The comparison result as an 8-bit mask.
+     */
+    template <typename _Tp, compare _Op>
+    inline unsigned __compare_mask8(const _Tp *_data, const compare_with<_Tp, _Op> &_pred) {
+        if constexpr (std::is_same<_Tp, float>::value) {
+            constexpr int imm =
+                _Op == compare::less ? _CMP_LT_OQ :
+                _Op == compare::less_equal ? _CMP_LE_OQ :
+                _Op == compare::greater ? _CMP_GT_OQ :
+                _Op == compare::greater_equal ? _CMP_GE_OQ :
+                _Op == compare::equal ? _CMP_EQ_OQ : _CMP_NEQ_UQ;
+            __m256 x = _mm256_loadu_ps(_data);
+            __m256 y = _mm256_set1_ps(_pred.value);
+            return unsigned(_mm256_movemask_ps(_mm256_cmp_ps(x, y, imm)));
+        } else {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_data));
+            __m256i y = _mm256_set1_epi32(std::int32_t(_pred.value));
+            if constexpr (std::is_unsigned<_Tp>::value) {
+                __m256i bias = _mm256_set1_epi32(INT32_MIN);
+                x = _mm256_xor_si256(x, bias);
+                y = _mm256_xor_si256(y, bias);
+            }
+            __m256i lt = _mm256_cmpgt_epi32(y, x);
+            __m256i gt = _mm256_cmpgt_epi32(x, y);
+            __m256i eq = _mm256_cmpeq_epi32(x, y);
+            __m256i r =
+                _Op == compare::less ? lt :
+                _Op == compare::less_equal ? _mm256_or_si256(lt, eq) :
+                _Op == compare::greater ? gt :
+                _Op == compare::greater_equal ? _mm256_or_si256(gt, eq) :
+                _Op == compare::equal ? eq : _mm256_andnot_si256(eq, _mm256_set1_epi32(-1));
+            return unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(r)));
+        }
+    }
+#endif
+
+    /**
+     * @brief Remove, in place, the elements matching a comparison predicate.
+     *
+     * The survivors keep their relative order. 32-bit elements are processed
+     * eight at a time with AVX2 when it is enabled at compile time; otherwise
+     * a branchless scalar loop is used.
+     *
+     * The predicate is never negated into the opposite comparison, which
+     * would be wrong for NaN; with _Keep set the selection is inverted
+     * instead, keeping the matching elements and removing the rest.
+     *
+     * @tparam _Keep Whether the predicate selects the elements to keep.
+     * @param _data The elements to filter.
+     * @param _size The number of elements.
+     * @param _pred The predicate selecting the elements to remove.
+     * @return The number of surviving elements.
+     */
+    template <bool _Keep = false, typename _Tp, compare _Op>
+    std::size_t __compact(_Tp *_data, std::size_t _size, const compare_with<_Tp, _Op> &_pred) {
+        static_assert(std::is_arithmetic<_Tp>::value, "arithmetic element type required");
+
+        std::size_t out = 0;
+        std::size_t i = 0;
+
+#if defined(__AVX2__)
+        if constexpr (sizeof(_Tp) == 4) {
+            for (; i + 8 <= _size; i += 8) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_data + i));
+                unsigned mask = __compare_mask8(_data + i, _pred);
+                unsigned keep = _Keep ? mask : ~mask & 0xffu;
+                __m256i perm = _mm256_cvtepu8_epi32(
+                    _mm_cvtsi64_si128((long long) __compact_lut._M_indices[keep]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(_data + out),
+                    _mm256_permutevar8x32_epi32(x, perm));
+                out += __builtin_popcount(keep);
+            }
+        }
+#endif
+
+        for (; i < _size; ++i) {
+            _Tp value = _data[i];
+            _data[out] = value;
+            out += _pred(value) == _Keep;
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Count the elements of a fixed-size block that are less than a value.
+     *
+     * The static search trees use it to pick a child: the block is sorted, so
+     * the count is the position of the first element not less than _value.
+     * Blocks of 32-bit arithmetic elements are compared eight at a time with
+     * AVX2 when it is enabled at compile time; otherwise a branchless scalar
+     * loop is used.
+     *
+     * @tparam _Nm The number of elements in the block.
+     * @param _data The elements of the block.
+     * @param _value The value to compare against.
+     * @return The number of elements less than _value.
+     */
+    template <std::size_t _Nm, typename _Tp>
+    inline std::size_t __count_less(const _Tp *_data, const _Tp &_value) {
+        std::size_t count = 0;
+
+#if defined(__AVX2__)
+        if constexpr (std::is_arithmetic<_Tp>::value && sizeof(_Tp) == 4 && _Nm % 8 == 0) {
+            const compare_with<_Tp, compare::less> pred {_value};
+            for (std::size_t i = 0; i < _Nm; i += 8) {
+                count += __builtin_popcount(__compare_mask8(_data + i, pred));
+            }
+            return count;
+        }
+#endif
+
+        for (std::size_t i = 0; i < _Nm; ++i) {
+            count += _data[i] < _value;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Count the elements of a sorted run that are less than a value.
+     *
+     * The run-time sized counterpart of the block version above, for nodes
+     * that are only partly filled.
+     *
+     * @param _data The elements of the run.
+     * @param _size The number of elements.
+     * @param _value The value to compare against.
+     * @return The number of elements less than _value.
+     */
+    template <typename _Tp>
+    inline std::size_t __count_less(const _Tp *_data, std::size_t _size, const _Tp &_value) {
+        std::size_t count = 0;
+        std::size_t i = 0;
+
+#if defined(__AVX2__)
+        if constexpr (std::is_arithmetic<_Tp>::value && sizeof(_Tp) == 4) {
+            const compare_with<_Tp, compare::less> pred {_value};
+            for (; i + 8 <= _size; i += 8) {
+                count += __builtin_popcount(__compare_mask8(_data + i, pred));
+            }
+        }
+#endif
+
+        for (; i < _size; ++i) {
+            count += _data[i] < _value;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Find a byte among the first bytes of a 16-byte block.
+     *
+     * Compares all 16 bytes at once with SSE2 when it is available; the
+     * whole block must be readable even when _count is smaller.
+     *
+     * @param _keys The block of bytes.
+     * @param _count The number of bytes in use, at most 16.
+     * @param _byte The byte to find.
+     * @return The index of the byte, or _count if it is absent.
+     */
+    inline unsigned __find_byte16(const unsigned char *_keys, unsigned _count, unsigned char _byte) {
+#if defined(__SSE2__)
+        __m128i eq = _mm_cmpeq_epi8(_mm_set1_epi8(char(_byte)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(_keys)));
+        unsigned mask = unsigned(_mm_movemask_epi8(eq)) & ((1u << _count) - 1);
+        return mask ? unsigned(__builtin_ctz(mask)) : _count;
+#else
+        for (unsigned i = 0; i < _count; ++i) {
+            if (_keys[i] == _byte) {
+                return i;
+            }
+        }
+        return _count;
+#endif
+    }
+
+    /**
+     * @brief Count the bytes less than a byte among the first bytes of a 16-byte block.
+     *
+     * The bytes are compared as unsigned, 16 at once with SSE2 when it is
+     * available; the whole block must be readable even when _count is smaller.
+     *
+     * @param _keys The block of bytes.
+     * @param _count The number of bytes in use, at most 16.
+     * @param _byte The byte to compare against.
+     * @return The number of bytes less than _byte.
+     */
+    inline unsigned __count_less_bytes16(const unsigned char *_keys, unsigned _count, unsigned char _byte) {
+#if defined(__SSE2__)
+        const __m128i bias = _mm_set1_epi8(char(0x80));
+        __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_keys)), bias);
+        __m128i y = _mm_xor_si128(_mm_set1_epi8(char(_byte)), bias);
+        unsigned mask = unsigned(_mm_movemask_epi8(_mm_cmplt_epi8(x, y))) & ((1u << _count) - 1);
+        return unsigned(__builtin_popcount(mask));
+#else
+        unsigned count = 0;
+        for (unsigned i = 0; i < _count; ++i) {
+            count += _keys[i] < _byte;
+        }
+        return count;
+#endif
+    }
+
+} // namespace cppds
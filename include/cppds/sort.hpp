@@ -0,0 +1,715 @@
+/**
+ * @file sort.hpp
+ * @brief Pattern-defeating quicksort and LSD radix sort.
+ */
+
+#pragma once
+
+#include <algorithm>            ///< For std::make_heap and std::sort_heap
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For fixed-width integer types
+#include <cstring>              ///< For std::memcpy
+#include <functional>           ///< For std::less and std::greater
+#include <iterator>             ///< For std::iterator_traits
+#include <type_traits>          ///< For std::is_arithmetic, std::conditional and std::is_default_constructible
+#include <utility>              ///< For std::move and std::pair
+
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief Tuning constants of the pattern-defeating quicksort.
+     */
+    enum : std::size_t {
+        __pdq_insertion_threshold = 24,     ///< Ranges below this size are insertion sorted.
+        __pdq_ninther_threshold = 128,      ///< Ranges above this size use the pseudomedian of nine.
+        __pdq_partial_insertion_limit = 8,  ///< Moves allowed before a partial insertion sort gives up.
+        __pdq_block_size = 64,              ///< Elements classified per block by the branchless partition.
+    };
+
+    /**
+     * @brief Whether a comparator is a plain ordering the branchless partition can evaluate cheaply.
+     */
+    template <typename _Compare, typename _Tp>
+    struct __is_default_compare : std::false_type {};
+
+    template <typename _Tp>
+    struct __is_default_compare<std::less<_Tp>, _Tp> : std::true_type {};
+
+    template <typename _Tp>
+    struct __is_default_compare<std::greater<_Tp>, _Tp> : std::true_type {};
+
+    template <typename _Tp>
+    struct __is_default_compare<std::less<>, _Tp> : std::true_type {};
+
+    template <typename _Tp>
+    struct __is_default_compare<std::greater<>, _Tp> : std::true_type {};
+
+    /**
+     * @brief Sort a range by insertion. Stable.
+     */
+    template <typename _RandomIt, typename _Compare>
+    void __pdq_insertion_sort(_RandomIt _first, _RandomIt _last, _Compare &_compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        if (_first == _last) {
+            return;
+        }
+
+        for (_RandomIt cur = _first + 1; cur != _last; ++cur) {
+            _RandomIt sift = cur;
+            _RandomIt sift_1 = cur - 1;
+
+            if (_compare(*sift, *sift_1)) {
+                value_type tmp = std::move(*sift);
+
+                do {
+                    *sift-- = std::move(*sift_1);
+                } while (sift != _first && _compare(tmp, *--sift_1));
+
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    /**
+     * @brief Sort a range by insertion, assuming the element before it is not greater than any in it.
+     */
+    template <typename _RandomIt, typename _Compare>
+    void __pdq_unguarded_insertion_sort(_RandomIt _first, _RandomIt _last, _Compare &_compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        if (_first == _last) {
+            return;
+        }
+
+        for (_RandomIt cur = _first + 1; cur != _last; ++cur) {
+            _RandomIt sift = cur;
+            _RandomIt sift_1 = cur - 1;
+
+            if (_compare(*sift, *sift_1)) {
+                value_type tmp = std::move(*sift);
+
+                do {
+                    *sift-- = std::move(*sift_1);
+                } while (_compare(tmp, *--sift_1));
+
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    /**
+     * @brief Insertion sort a range, giving up after a few moves.
+     *
+     * @return `true` if the range is sorted, `false` if the attempt was abandoned.
+     */
+    template <typename _RandomIt, typename _Compare>
+    bool __pdq_partial_insertion_sort(_RandomIt _first, _RandomIt _last, _Compare &_compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        if (_first == _last) {
+            return true;
+        }
+
+        std::size_t moves = 0;
+
+        for (_RandomIt cur = _first + 1; cur != _last; ++cur) {
+            _RandomIt sift = cur;
+            _RandomIt sift_1 = cur - 1;
+
+            if (_compare(*sift, *sift_1)) {
+                value_type tmp = std::move(*sift);
+
+                do {
+                    *sift-- = std::move(*sift_1);
+                } while (sift != _first && _compare(tmp, *--sift_1));
+
+                *sift = std::move(tmp);
+                moves += std::size_t(cur - sift);
+
+                if (moves > __pdq_partial_insertion_limit) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename _RandomIt, typename _Compare>
+    void __pdq_sort2(_RandomIt _a, _RandomIt _b, _Compare &_compare) {
+        if (_compare(*_b, *_a)) {
+            std::iter_swap(_a, _b);
+        }
+    }
+
+    template <typename _RandomIt, typename _Compare>
+    void __pdq_sort3(_RandomIt _a, _RandomIt _b, _RandomIt _c, _Compare &_compare) {
+        __pdq_sort2(_a, _b, _compare);
+        __pdq_sort2(_b, _c, _compare);
+        __pdq_sort2(_a, _b, _compare);
+    }
+
+    /**
+     * @brief Partition around the pivot at _first, putting elements equal to it on the right.
+     *
+     * @return The final position of the pivot, and whether the range was already partitioned.
+     */
+    template <typename _RandomIt, typename _Compare>
+    std::pair<_RandomIt, bool> __pdq_partition_right(_RandomIt _first, _RandomIt _last, _Compare &_compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        value_type pivot = std::move(*_first);
+
+        _RandomIt first = _first;
+        _RandomIt last = _last;
+
+        // The median-of-three guarantees an element not less than the pivot
+        // on the right, and the pivot itself bounds the scan from the left.
+        while (_compare(*++first, pivot));
+
+        if (first - 1 == _first) {
+            while (first < last && !_compare(*--last, pivot));
+        }
+        else {
+            while (!_compare(*--last, pivot));
+        }
+
+        bool already_partitioned = first >= last;
+
+        while (first < last) {
+            std::iter_swap(first, last);
+            while (_compare(*++first, pivot));
+            while (!_compare(*--last, pivot));
+        }
+
+        _RandomIt pivot_pos = first - 1;
+        *_first = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+
+        return {pivot_pos, already_partitioned};
+    }
+
+    /**
+     * @brief Swap the misplaced elements found by two blocks of the branchless partition.
+     *
+     * When the counts differ, the elements are rotated through one temporary
+     * instead of swapped pairwise, which halves the moves.
+     */
+    template <typename _RandomIt>
+    void __pdq_swap_offsets(_RandomIt _first, _RandomIt _last, const unsigned char *_offsets_l,
+            const unsigned char *_offsets_r, std::size_t _count, bool _use_swaps) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        if (_use_swaps) {
+            for (std::size_t i = 0; i < _count; ++i) {
+                std::iter_swap(_first + _offsets_l[i], _last - _offsets_r[i]);
+            }
+        }
+        else if (_count > 0) {
+            _RandomIt l = _first + _offsets_l[0];
+            _RandomIt r = _last - _offsets_r[0];
+
+            value_type tmp = std::move(*l);
+            *l = std::move(*r);
+
+            for (std::size_t i = 1; i < _count; ++i) {
+                l = _first + _offsets_l[i];
+                *r = std::move(*l);
+                r = _last - _offsets_r[i];
+                *l = std::move(*r);
+            }
+
+            *r = std::move(tmp);
+        }
+    }
+
+    /**
+     * @brief Branchless variant of __pdq_partition_right.
+     *
+     * Blocks of elements from each end are first classified into offset
+     * buffers, with the comparison result added to a counter rather than
+     * branched on, and the misplaced elements are then swapped in bulk.
+     * This avoids the branch mispredictions of the classic scan when
+     * comparisons are cheap, as for arithmetic types.
+     */
+    template <typename _RandomIt, typename _Compare>
+    std::pair<_RandomIt, bool> __pdq_partition_right_branchless(_RandomIt _first, _RandomIt _last, _Compare &_compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        value_type pivot = std::move(*_first);
+
+        _RandomIt first = _first;
+        _RandomIt last = _last;
+
+        while (_compare(*++first, pivot));
+
+        if (first - 1 == _first) {
+            while (first < last && !_compare(*--last, pivot));
+        }
+        else {
+            while (!_compare(*--last, pivot));
+        }
+
+        bool already_partitioned = first >= last;
+
+        if (!already_partitioned) {
+            std::iter_swap(first, last);
+            ++first;
+
+            alignas(64) unsigned char offsets_l[__pdq_block_size];
+            alignas(64) unsigned char offsets_r[__pdq_block_size];
+
+            _RandomIt offsets_l_base = first;
+            _RandomIt offsets_r_base = last;
+
+            std::size_t num_l = 0;
+            std::size_t num_r = 0;
+            std::size_t start_l = 0;
+            std::size_t start_r = 0;
+
+            while (first < last) {
+                // Fill whichever offset buffers are empty, splitting what is
+                // left between them when both are.
+                std::size_t num_unknown = std::size_t(last - first);
+                std::size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                std::size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+                if (left_split > __pdq_block_size) {
+                    left_split = __pdq_block_size;
+                }
+                if (right_split > __pdq_block_size) {
+                    right_split = __pdq_block_size;
+                }
+
+                for (std::size_t i = 0; i < left_split; ++i) {
+                    offsets_l[num_l] = (unsigned char) i;
+                    num_l += !_compare(*first, pivot);
+                    ++first;
+                }
+
+                for (std::size_t i = 0; i < right_split; ) {
+                    offsets_r[num_r] = (unsigned char) ++i;
+                    num_r += _compare(*--last, pivot);
+                }
+
+                std::size_t num = num_l < num_r ? num_l : num_r;
+                __pdq_swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                    num, num_l == num_r);
+
+                num_l -= num;
+                num_r -= num;
+                start_l += num;
+                start_r += num;
+
+                if (num_l == 0) {
+                    start_l = 0;
+                    offsets_l_base = first;
+                }
+
+                if (num_r == 0) {
+                    start_r = 0;
+                    offsets_r_base = last;
+                }
+            }
+
+            // One buffer may still hold misplaced elements; move them to the boundary.
+            if (num_l) {
+                while (num_l--) {
+                    std::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+                }
+                first = last;
+            }
+
+            if (num_r) {
+                while (num_r--) {
+                    std::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                    ++first;
+                }
+                last = first;
+            }
+        }
+
+        _RandomIt pivot_pos = first - 1;
+        *_first = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+
+        return {pivot_pos, already_partitioned};
+    }
+
+    /**
+     * @brief Partition around the pivot at _first, putting elements equal to it on the left.
+     *
+     * Used when the pivot equals the element before the range, so that runs of
+     * equal elements are split off in linear time.
+     *
+     * @return The final position of the pivot.
+     */
+    template <typename _RandomIt, typename _Compare>
+    _RandomIt __pdq_partition_left(_RandomIt _first, _RandomIt _last, _Compare &_compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        value_type pivot = std::move(*_first);
+
+        _RandomIt first = _first;
+        _RandomIt last = _last;
+
+        while (_compare(pivot, *--last));
+
+        if (last + 1 == _last) {
+            while (first < last && !_compare(pivot, *++first));
+        }
+        else {
+            while (!_compare(pivot, *++first));
+        }
+
+        while (first < last) {
+            std::iter_swap(first, last);
+            while (_compare(pivot, *--last));
+            while (!_compare(pivot, *++first));
+        }
+
+        _RandomIt pivot_pos = last;
+        *_first = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+
+        return pivot_pos;
+    }
+
+    /**
+     * @brief The pattern-defeating quicksort loop; recurses on the left part and loops on the right.
+     *
+     * @param _bad_allowed The number of highly unbalanced partitions allowed before falling back to heapsort.
+     * @param _leftmost Whether the range starts the whole input, i.e. has no element before it.
+     */
+    template <bool _Branchless, typename _RandomIt, typename _Compare>
+    void __pdqsort_loop(_RandomIt _first, _RandomIt _last, _Compare &_compare, int _bad_allowed, bool _leftmost) {
+        while (true) {
+            std::size_t size = std::size_t(_last - _first);
+
+            if (size < __pdq_insertion_threshold) {
+                if (_leftmost) {
+                    __pdq_insertion_sort(_first, _last, _compare);
+                }
+                else {
+                    __pdq_unguarded_insertion_sort(_first, _last, _compare);
+                }
+                return;
+            }
+
+            // Choose the pivot as the median of three, or the pseudomedian of
+            // nine for large ranges, and move it to the front.
+            std::size_t half = size / 2;
+
+            if (size > __pdq_ninther_threshold) {
+                __pdq_sort3(_first, _first + half, _last - 1, _compare);
+                __pdq_sort3(_first + 1, _first + (half - 1), _last - 2, _compare);
+                __pdq_sort3(_first + 2, _first + (half + 1), _last - 3, _compare);
+                __pdq_sort3(_first + (half - 1), _first + half, _first + (half + 1), _compare);
+                std::iter_swap(_first, _first + half);
+            }
+            else {
+                __pdq_sort3(_first + half, _first, _last - 1, _compare);
+            }
+
+            // A pivot equal to the element before the range cannot be less
+            // than anything in it: split off the run of elements equal to it.
+            if (!_leftmost && !_compare(*(_first - 1), *_first)) {
+                _first = __pdq_partition_left(_first, _last, _compare) + 1;
+                continue;
+            }
+
+            std::pair<_RandomIt, bool> part = _Branchless
+                ? __pdq_partition_right_branchless(_first, _last, _compare)
+                : __pdq_partition_right(_first, _last, _compare);
+
+            _RandomIt pivot_pos = part.first;
+            bool already_partitioned = part.second;
+
+            std::size_t l_size = std::size_t(pivot_pos - _first);
+            std::size_t r_size = std::size_t(_last - (pivot_pos + 1));
+
+            if (l_size < size / 8 || r_size < size / 8) {
+                // Too many bad partitions mean an adversarial pattern: fall
+                // back to heapsort for the guaranteed O(n log n).
+                if (--_bad_allowed == 0) {
+                    std::make_heap(_first, _last, _compare);
+                    std::sort_heap(_first, _last, _compare);
+                    return;
+                }
+
+                // Otherwise break the pattern by swapping a few elements.
+                if (l_size >= __pdq_insertion_threshold) {
+                    std::iter_swap(_first, _first + l_size / 4);
+                    std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+                    if (l_size > __pdq_ninther_threshold) {
+                        std::iter_swap(_first + 1, _first + (l_size / 4 + 1));
+                        std::iter_swap(_first + 2, _first + (l_size / 4 + 2));
+                        std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                        std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                    }
+                }
+
+                if (r_size >= __pdq_insertion_threshold) {
+                    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                    std::iter_swap(_last - 1, _last - r_size / 4);
+
+                    if (r_size > __pdq_ninther_threshold) {
+                        std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                        std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                        std::iter_swap(_last - 2, _last - (1 + r_size / 4));
+                        std::iter_swap(_last - 3, _last - (2 + r_size / 4));
+                    }
+                }
+            }
+            else if (already_partitioned
+                && __pdq_partial_insertion_sort(_first, pivot_pos, _compare)
+                && __pdq_partial_insertion_sort(pivot_pos + 1, _last, _compare)) {
+                // A well-balanced partition that needed no swaps suggests a
+                // nearly sorted input, which insertion sort finishes cheaply.
+                return;
+            }
+
+            __pdqsort_loop<_Branchless>(_first, pivot_pos, _compare, _bad_allowed, _leftmost);
+            _first = pivot_pos + 1;
+            _leftmost = false;
+        }
+    }
+
+    /**
+     * @brief Sort a range with pattern-defeating quicksort.
+     *
+     * Runs in O(n log n) worst case and O(n) on sorted, reverse sorted and
+     * many-duplicate inputs. Arithmetic elements compared with std::less or
+     * std::greater are partitioned branchlessly. Not stable.
+     *
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     * @param _compare The strict weak ordering of the elements.
+     */
+    template <typename _RandomIt, typename _Compare>
+    void sort(_RandomIt _first, _RandomIt _last, _Compare _compare) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        constexpr bool branchless = std::is_arithmetic<value_type>::value
+            && __is_default_compare<_Compare, value_type>::value;
+
+        std::size_t size = std::size_t(_last - _first);
+        if (size < 2) {
+            return;
+        }
+
+        int log2 = 0;
+        while (size >>= 1) {
+            ++log2;
+        }
+
+        __pdqsort_loop<branchless>(_first, _last, _compare, log2, true);
+    }
+
+    /**
+     * @brief Sort a range in ascending order with pattern-defeating quicksort.
+     *
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     */
+    template <typename _RandomIt>
+    void sort(_RandomIt _first, _RandomIt _last) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        cppds::sort(_first, _last, std::less<value_type>());
+    }
+
+    /**
+     * @brief Map an arithmetic key to an unsigned integer with the same order.
+     *
+     * Signed integers get their sign bit flipped. Floating-point numbers with
+     * the sign bit set have all bits flipped and the others only the sign
+     * bit, which orders negatives below positives and -0.0 just below +0.0;
+     * NaNs sort to the ends according to their sign.
+     */
+    template <typename _Key>
+    auto __radix_key(_Key _key) {
+        static_assert(std::is_arithmetic<_Key>::value && sizeof(_Key) <= 8,
+            "radix_sort keys must be arithmetic types of at most 64 bits");
+
+        if constexpr (std::is_floating_point<_Key>::value) {
+            using __bits_type = typename std::conditional<sizeof(_Key) == 4, std::uint32_t, std::uint64_t>::type;
+
+            __bits_type bits;
+            std::memcpy(&bits, &_key, sizeof(bits));
+
+            constexpr __bits_type sign = __bits_type(1) << (sizeof(__bits_type) * 8 - 1);
+            return __bits_type(bits ^ ((__bits_type(0) - (bits >> (sizeof(__bits_type) * 8 - 1))) | sign));
+        }
+        else if constexpr (std::is_same<_Key, bool>::value) {
+            return std::uint8_t(_key);
+        }
+        else {
+            using __bits_type = typename std::make_unsigned<_Key>::type;
+
+            if constexpr (std::is_signed<_Key>::value) {
+                constexpr __bits_type sign = __bits_type(1) << (sizeof(__bits_type) * 8 - 1);
+                return __bits_type(__bits_type(_key) ^ sign);
+            }
+            else {
+                return __bits_type(_key);
+            }
+        }
+    }
+
+    /**
+     * @brief LSD radix sort with digits of _Bits bits, using a buffer as large as the range.
+     */
+    template <unsigned _Bits, typename _RandomIt, typename _KeyFn, typename _Tp>
+    void __lsd_radix_sort(_RandomIt _first, std::size_t _count, _KeyFn &_key, _Tp *_buffer) {
+        using __bits_type = decltype(__radix_key(_key(*_first)));
+
+        constexpr unsigned passes = (sizeof(__bits_type) * 8 + _Bits - 1) / _Bits;
+        constexpr std::size_t radix = std::size_t(1) << _Bits;
+        constexpr std::size_t mask = radix - 1;
+
+        // Count the digits of all passes in a single read of the input.
+        vector<std::size_t> counts;
+        counts.resize(passes * radix, std::size_t(0));
+
+        for (std::size_t i = 0; i < _count; ++i) {
+            __bits_type bits = __radix_key(_key(_first[i]));
+
+            for (unsigned pass = 0; pass < passes; ++pass) {
+                ++counts[pass * radix + ((bits >> (pass * _Bits)) & mask)];
+            }
+        }
+
+        bool in_buffer = false;
+
+        auto scatter = [&](auto _src, auto _dst, unsigned _pass, std::size_t *_offsets) {
+            for (std::size_t i = 0; i < _count; ++i) {
+                __bits_type bits = __radix_key(_key(_src[i]));
+                _dst[_offsets[(bits >> (_pass * _Bits)) & mask]++] = std::move(_src[i]);
+            }
+        };
+
+        for (unsigned pass = 0; pass < passes; ++pass) {
+            std::size_t *offsets = counts.data() + pass * radix;
+
+            // A digit shared by every key leaves the order unchanged.
+            bool trivial = false;
+            std::size_t sum = 0;
+
+            for (std::size_t digit = 0; digit < radix; ++digit) {
+                if (offsets[digit] == _count) {
+                    trivial = true;
+                    break;
+                }
+
+                std::size_t count = offsets[digit];
+                offsets[digit] = sum;
+                sum += count;
+            }
+
+            if (trivial) {
+                continue;
+            }
+
+            if (in_buffer) {
+                scatter(_buffer, _first, pass, offsets);
+            }
+            else {
+                scatter(_first, _buffer, pass, offsets);
+            }
+
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer) {
+            for (std::size_t i = 0; i < _count; ++i) {
+                _first[i] = std::move(_buffer[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Sort a range by an arithmetic key with LSD radix sort.
+     *
+     * Sorts in O(n) passes over the data, one per digit of the key, skipping
+     * digits that all keys share. Integer and floating-point keys are ordered
+     * numerically; -0.0 sorts before +0.0. Stable, and uses a buffer as large
+     * as the range.
+     *
+     * @tparam _DigitBits The digit width: 8, 11 or 16 bits, or 0 to choose
+     *         from the key width and the size of the range.
+     * @tparam _RandomIt A random access iterator whose value type is default
+     *         constructible and move assignable: the buffer is
+     *         default-initialized and elements are moved through it.
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     * @param _key Called as `_key(element)`; returns the arithmetic key of the element.
+     */
+    template <unsigned _DigitBits = 0, typename _RandomIt, typename _KeyFn>
+    void radix_sort(_RandomIt _first, _RandomIt _last, _KeyFn _key) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+        using __bits_type = decltype(__radix_key(_key(*_first)));
+
+        static_assert(_DigitBits == 0 || _DigitBits == 8 || _DigitBits == 11 || _DigitBits == 16,
+            "radix_sort digits must be 8, 11 or 16 bits");
+        static_assert(std::is_default_constructible<value_type>::value,
+            "radix_sort requires default constructible elements for its buffer");
+
+        std::size_t count = std::size_t(_last - _first);
+
+        // Small ranges are not worth the histograms.
+        if (count < 64) {
+            auto compare = [&_key](const value_type &_a, const value_type &_b) {
+                return __radix_key(_key(_a)) < __radix_key(_key(_b));
+            };
+            __pdq_insertion_sort(_first, _last, compare);
+            return;
+        }
+
+        vector<value_type> buffer;
+        buffer.resize(count, default_init);
+
+        if constexpr (_DigitBits == 8 || sizeof(__bits_type) == 1) {
+            __lsd_radix_sort<8>(_first, count, _key, buffer.data());
+        }
+        else if constexpr (_DigitBits == 11) {
+            __lsd_radix_sort<11>(_first, count, _key, buffer.data());
+        }
+        else if constexpr (_DigitBits == 16) {
+            __lsd_radix_sort<16>(_first, count, _key, buffer.data());
+        }
+        else if constexpr (sizeof(__bits_type) == 2) {
+            __lsd_radix_sort<8>(_first, count, _key, buffer.data());
+        }
+        else if (count < (std::size_t(1) << 16)) {
+            __lsd_radix_sort<8>(_first, count, _key, buffer.data());
+        }
+        else {
+            // Wider digits mean fewer passes, but 16-bit digits scatter to
+            // more destinations than the TLB covers and lost on every size
+            // measured; 11-bit digits win once the range outgrows the cache.
+            __lsd_radix_sort<11>(_first, count, _key, buffer.data());
+        }
+    }
+
+    /**
+     * @brief Sort a range of arithmetic values in ascending order with LSD radix sort.
+     *
+     * @tparam _DigitBits The digit width: 8, 11 or 16 bits, or 0 to choose automatically.
+     * @tparam _RandomIt A random access iterator over default constructible values.
+     * @param _first The beginning of the range.
+     * @param _last The end of the range.
+     */
+    template <unsigned _DigitBits = 0, typename _RandomIt>
+    void radix_sort(_RandomIt _first, _RandomIt _last) {
+        using value_type = typename std::iterator_traits<_RandomIt>::value_type;
+
+        cppds::radix_sort<_DigitBits>(_first, _last, [](const value_type &_value) {
+            return _value;
+        });
+    }
+}
@@ -0,0 +1,341 @@
+/**
+ * @file static_search_index.hpp
+ * @brief Cache-friendly layouts for searching a static sorted sequence.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For std::uint32_t and std::uintptr_t
+#include <initializer_list>     ///< For std::initializer_list
+#include <iterator>             ///< For std::iterator_traits
+#include <stdexcept>            ///< For std::length_error exception
+
+#include "simd.hpp"
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A lower_bound index over a static sorted sequence in Eytzinger layout.
+     *
+     * The keys are stored in breadth-first order of the implicit binary search
+     * tree, so the first levels of every search share a few hot cache lines
+     * and the children of a node are adjacent. The search is branchless and
+     * prefetches the cache line holding the descendants several levels ahead,
+     * which hides most of the memory latency of searches over large inputs.
+     * Results are ranks, i.e. the indices lower_bound would return on the
+     * original sorted sequence.
+     *
+     * Keys are compared with operator<. Up to 2^32 - 1 keys are supported.
+     *
+     * @tparam _Tp The type of keys.
+     */
+    template <typename _Tp>
+    class static_search_index {
+    public:
+        using value_type = _Tp;             ///< The type of keys.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /**
+         * @brief Default constructor. Creates an empty index.
+         */
+        static_search_index() {
+            __build(vector<value_type>());
+        }
+
+        /**
+         * @brief Constructor that builds the index from a sorted range.
+         *
+         * @param _first The beginning of the sorted range.
+         * @param _last The end of the sorted range.
+         * @throw std::length_error if the range has 2^32 or more keys.
+         */
+        template <typename _InputIt>
+        static_search_index(_InputIt _first, _InputIt _last) {
+            vector<value_type> sorted(_first, _last);
+            __build(sorted);
+        }
+
+        /**
+         * @brief Constructor that builds the index from a sorted vector.
+         *
+         * @param _sorted The sorted keys.
+         * @throw std::length_error if there are 2^32 or more keys.
+         */
+        explicit static_search_index(const vector<value_type> &_sorted) {
+            __build(_sorted);
+        }
+
+        /**
+         * @brief Constructor that builds the index from a sorted initializer list.
+         *
+         * @param _list An initializer list of sorted keys.
+         */
+        static_search_index(const std::initializer_list<value_type> &_list)
+            : static_search_index(_list.begin(), _list.end()) {}
+
+        /**
+         * @brief Find the rank of the first key not less than a value.
+         *
+         * @param _value The value to search for.
+         * @return The index of the key in the sorted sequence, or size() if all keys are less.
+         */
+        size_type lower_bound(const value_type &_value) const {
+            return this->_M_ranks[__search(_value)];
+        }
+
+        /**
+         * @brief Check if a key exists in the index.
+         *
+         * @param _value The key to check for.
+         * @return `true` if the key exists, `false` otherwise.
+         */
+        bool contains(const value_type &_value) const {
+            size_type k = __search(_value);
+            return k != 0 && !(_value < this->_M_keys[k]);
+        }
+
+        /**
+         * @brief Get the number of keys.
+         *
+         * @return The number of keys in the index.
+         */
+        size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Check if the index is empty.
+         *
+         * @return `true` if the index has no keys, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_size == 0;
+        }
+
+    protected:
+        // Keys sharing a cache line with the descendants four levels down.
+        static constexpr size_type __prefetch_stride = sizeof(_Tp) < 64 ? 64 / sizeof(_Tp) : 1;
+
+        void __build(const vector<value_type> &_sorted) {
+            if (_sorted.size() >= UINT32_MAX) {
+                throw std::length_error("static_search_index is limited to 2^32 - 1 keys");
+            }
+
+            this->_M_size = _sorted.size();
+
+            // Slot 0 is unused by the tree; its rank is the "not found" result.
+            this->_M_keys.resize(this->_M_size + 1);
+            this->_M_ranks.resize(this->_M_size + 1);
+            this->_M_ranks[0] = std::uint32_t(this->_M_size);
+
+            size_type rank = 0;
+            __fill(_sorted, rank, 1);
+        }
+
+        void __fill(const vector<value_type> &_sorted, size_type &_rank, size_type _k) {
+            if (_k <= this->_M_size) {
+                __fill(_sorted, _rank, 2 * _k);
+                this->_M_keys[_k] = _sorted[_rank];
+                this->_M_ranks[_k] = std::uint32_t(_rank++);
+                __fill(_sorted, _rank, 2 * _k + 1);
+            }
+        }
+
+        /**
+         * @brief Descend the tree and return the slot of the lower bound, or 0.
+         */
+        size_type __search(const value_type &_value) const {
+            const value_type *keys = this->_M_keys.data();
+            size_type k = 1;
+
+            while (k <= this->_M_size) {
+                // Only the address is formed; prefetching past the end is harmless.
+                __builtin_prefetch(reinterpret_cast<const void *>(
+                    reinterpret_cast<std::uintptr_t>(keys) + k * __prefetch_stride * sizeof(_Tp)));
+                k = 2 * k + (keys[k] < _value);
+            }
+
+            // Undo the right turns taken after the last left turn.
+            k >>= __builtin_ffsll(~(long long) k);
+
+            return k;
+        }
+
+        aligned_vector<value_type, 64> _M_keys {};      // Keys in Eytzinger order, from slot 1
+        vector<std::uint32_t> _M_ranks {};              // Sorted index of the key in each slot
+        size_type _M_size = 0;                          // The number of keys
+    };
+
+    /**
+     * @brief A lower_bound index over a static sorted sequence in S-tree layout.
+     *
+     * The keys are stored as an implicit B-tree whose nodes are single cache
+     * lines of keys, so a search touches one line per level and does
+     * log_(B+1)(n) dependent loads instead of log_2(n). The position within a
+     * node is found by comparing against all its keys at once, with AVX2 for
+     * 32-bit keys when it is enabled at compile time. Results are ranks, as
+     * with static_search_index.
+     *
+     * Keys are compared with operator<. Up to 2^32 - 1 keys are supported.
+     *
+     * @tparam _Tp The type of keys.
+     */
+    template <typename _Tp>
+    class static_search_tree {
+    public:
+        using value_type = _Tp;             ///< The type of keys.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /// The number of keys in a node.
+        static constexpr size_type node_size = sizeof(_Tp) <= 16 ? 64 / sizeof(_Tp) : 4;
+
+        /**
+         * @brief Default constructor. Creates an empty index.
+         */
+        static_search_tree() = default;
+
+        /**
+         * @brief Constructor that builds the index from a sorted range.
+         *
+         * @param _first The beginning of the sorted range.
+         * @param _last The end of the sorted range.
+         * @throw std::length_error if the range has 2^32 or more keys.
+         */
+        template <typename _InputIt>
+        static_search_tree(_InputIt _first, _InputIt _last) {
+            vector<value_type> sorted(_first, _last);
+            __build(sorted);
+        }
+
+        /**
+         * @brief Constructor that builds the index from a sorted vector.
+         *
+         * @param _sorted The sorted keys.
+         * @throw std::length_error if there are 2^32 or more keys.
+         */
+        explicit static_search_tree(const vector<value_type> &_sorted) {
+            __build(_sorted);
+        }
+
+        /**
+         * @brief Constructor that builds the index from a sorted initializer list.
+         *
+         * @param _list An initializer list of sorted keys.
+         */
+        static_search_tree(const std::initializer_list<value_type> &_list)
+            : static_search_tree(_list.begin(), _list.end()) {}
+
+        /**
+         * @brief Find the rank of the first key not less than a value.
+         *
+         * @param _value The value to search for.
+         * @return The index of the key in the sorted sequence, or size() if all keys are less.
+         */
+        size_type lower_bound(const value_type &_value) const {
+            size_type slot = __search(_value);
+            return slot == __npos ? this->_M_size : this->_M_ranks[slot];
+        }
+
+        /**
+         * @brief Check if a key exists in the index.
+         *
+         * @param _value The key to check for.
+         * @return `true` if the key exists, `false` otherwise.
+         */
+        bool contains(const value_type &_value) const {
+            size_type slot = __search(_value);
+            return slot != __npos && !(_value < this->_M_keys[slot]);
+        }
+
+        /**
+         * @brief Get the number of keys.
+         *
+         * @return The number of keys in the index.
+         */
+        size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Check if the index is empty.
+         *
+         * @return `true` if the index has no keys, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_size == 0;
+        }
+
+    protected:
+        static constexpr size_type __npos = size_type(-1);
+
+        static size_type __child(size_type _node, size_type _branch) {
+            return _node * (node_size + 1) + _branch + 1;
+        }
+
+        void __build(const vector<value_type> &_sorted) {
+            if (_sorted.size() >= UINT32_MAX) {
+                throw std::length_error("static_search_tree is limited to 2^32 - 1 keys");
+            }
+
+            this->_M_size = _sorted.size();
+            this->_M_nodes = (this->_M_size + node_size - 1) / node_size;
+
+            this->_M_keys.resize(this->_M_nodes * node_size);
+            this->_M_ranks.resize(this->_M_nodes * node_size);
+
+            size_type rank = 0;
+            __fill(_sorted, rank, 0);
+        }
+
+        void __fill(const vector<value_type> &_sorted, size_type &_rank, size_type _node) {
+            if (_node >= this->_M_nodes) {
+                return;
+            }
+
+            for (size_type i = 0; i < node_size; ++i) {
+                __fill(_sorted, _rank, __child(_node, i));
+
+                // Padding follows every key in order; repeating the largest key
+                // keeps each node sorted without needing a maximum value.
+                size_type slot = _node * node_size + i;
+                if (_rank < this->_M_size) {
+                    this->_M_keys[slot] = _sorted[_rank];
+                    this->_M_ranks[slot] = std::uint32_t(_rank++);
+                } else {
+                    this->_M_keys[slot] = _sorted[this->_M_size - 1];
+                    this->_M_ranks[slot] = std::uint32_t(this->_M_size);
+                }
+            }
+
+            __fill(_sorted, _rank, __child(_node, node_size));
+        }
+
+        /**
+         * @brief Descend the tree and return the slot of the lower bound, or __npos.
+         */
+        size_type __search(const value_type &_value) const {
+            const value_type *keys = this->_M_keys.data();
+            size_type result = __npos;
+            size_type node = 0;
+
+            while (node < this->_M_nodes) {
+                size_type branch = __count_less<node_size>(keys + node * node_size, _value);
+
+                if (branch < node_size) {
+                    result = node * node_size + branch;
+                }
+
+                node = __child(node, branch);
+            }
+
+            return result;
+        }
+
+        aligned_vector<value_type, 64> _M_keys {};      // Node keys, node_size per node
+        vector<std::uint32_t> _M_ranks {};              // Sorted index of the key in each slot
+        size_type _M_size = 0;                          // The number of keys
+        size_type _M_nodes = 0;                         // The number of nodes
+    };
+}
@@ -0,0 +1,591 @@
+/**
+ * @file static_vector.hpp
+ * @brief A fixed-capacity vector container class with inline storage.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <initializer_list>     ///< For std::initializer_list
+#include <new>                  ///< For placement new and std::launder
+#include <stdexcept>            ///< For std::out_of_range and std::length_error exceptions
+#include <type_traits>          ///< For std::is_trivial, std::is_trivially_copyable and friends
+#include <utility>              ///< For std::move and std::forward
+
+namespace cppds {
+
+    /**
+     * @brief Inline storage of a static_vector.
+     *
+     * The primary template is used for element types that are not trivially
+     * copyable or not trivially destructible: the storage is a raw, suitably
+     * aligned byte buffer and elements are constructed in place. Copy, move and
+     * destruction are implemented element by element.
+     *
+     * @tparam _Tp The type of elements stored in the vector.
+     * @tparam _Nm The maximum number of elements.
+     */
+    template <typename _Tp, std::size_t _Nm,
+        bool = std::is_trivially_copyable<_Tp>::value && std::is_trivially_destructible<_Tp>::value>
+    class __static_vector_storage {
+    protected:
+        using value_type = _Tp;
+        using size_type = std::size_t;
+
+        __static_vector_storage() = default;
+
+        __static_vector_storage(const __static_vector_storage &_other) {
+            for (size_type i = 0; i < _other._M_size; ++i) {
+                __construct(i, _other.__data()[i]);
+            }
+            _M_size = _other._M_size;
+        }
+
+        __static_vector_storage(__static_vector_storage &&_other) {
+            for (size_type i = 0; i < _other._M_size; ++i) {
+                __construct(i, std::move(_other.__data()[i]));
+            }
+            _M_size = _other._M_size;
+        }
+
+        __static_vector_storage &operator=(const __static_vector_storage &_other) {
+            if (this != &_other) {
+                __destroy_all();
+                for (size_type i = 0; i < _other._M_size; ++i) {
+                    __construct(i, _other.__data()[i]);
+                    _M_size = i + 1;
+                }
+            }
+            return *this;
+        }
+
+        __static_vector_storage &operator=(__static_vector_storage &&_other) {
+            if (this != &_other) {
+                __destroy_all();
+                for (size_type i = 0; i < _other._M_size; ++i) {
+                    __construct(i, std::move(_other.__data()[i]));
+                    _M_size = i + 1;
+                }
+            }
+            return *this;
+        }
+
+        ~__static_vector_storage() {
+            __destroy_all();
+        }
+
+        value_type *__data() {
+            return std::launder(reinterpret_cast<value_type *>(_M_storage));
+        }
+
+        const value_type *__data() const {
+            return std::launder(reinterpret_cast<const value_type *>(_M_storage));
+        }
+
+        template <typename... _Args>
+        void __construct(size_type _index, _Args &&..._args) {
+            ::new (static_cast<void *>(_M_storage + _index * sizeof(value_type)))
+                value_type(std::forward<_Args>(_args)...);
+        }
+
+        void __destroy(size_type _index) {
+            __data()[_index].~value_type();
+        }
+
+        void __destroy_all() {
+            for (size_type i = 0; i < _M_size; ++i) {
+                __destroy(i);
+            }
+            _M_size = 0;
+        }
+
+        alignas(value_type) unsigned char _M_storage[(_Nm ? _Nm : 1) * sizeof(value_type)];  ///< Uninitialized element storage.
+        size_type _M_size {};   ///< The number of constructed elements.
+    };
+
+    /**
+     * @brief An array of elements wrapped in a union, so that default
+     * construction constructs none of them.
+     *
+     * For trivially default constructible types the union is trivial and its
+     * value initialization activates the array, which constant evaluation
+     * requires. Otherwise the user-provided constructor leaves it inactive.
+     */
+    template <typename _Tp, std::size_t _Nm, bool = std::is_trivially_default_constructible<_Tp>::value>
+    union __static_vector_array {
+        _Tp _M_values[_Nm ? _Nm : 1];
+    };
+
+    template <typename _Tp, std::size_t _Nm>
+    union __static_vector_array<_Tp, _Nm, false> {
+        __static_vector_array() {}
+
+        _Tp _M_values[_Nm ? _Nm : 1];
+    };
+
+    /**
+     * @brief Inline storage of a static_vector for trivially copyable and
+     * trivially destructible element types.
+     *
+     * The storage is an array in a union left uninitialized by the default
+     * constructor, even when the element type has a non-trivial default
+     * constructor. All copy, move and destruction members are defaulted, so the
+     * owning static_vector is trivially copyable and may be copied with
+     * std::memcpy. For trivial element types the value-initializing constructor
+     * makes the storage usable in constant expressions.
+     *
+     * @tparam _Tp The type of elements stored in the vector.
+     * @tparam _Nm The maximum number of elements.
+     */
+    template <typename _Tp, std::size_t _Nm>
+    class __static_vector_storage<_Tp, _Nm, true> {
+    protected:
+        using value_type = _Tp;
+        using size_type = std::size_t;
+
+        struct __value_init_t {};
+
+        __static_vector_storage() = default;
+
+        constexpr explicit __static_vector_storage(__value_init_t) :
+            _M_storage {}, _M_size {} {}
+
+        constexpr value_type *__data() {
+            return _M_storage._M_values;
+        }
+
+        constexpr const value_type *__data() const {
+            return _M_storage._M_values;
+        }
+
+        template <typename... _Args>
+        constexpr void __construct(size_type _index, _Args &&..._args) {
+            if constexpr (std::is_trivially_default_constructible<value_type>::value) {
+                _M_storage._M_values[_index] = value_type(std::forward<_Args>(_args)...);
+            } else {
+                ::new (static_cast<void *>(_M_storage._M_values + _index))
+                    value_type(std::forward<_Args>(_args)...);
+            }
+        }
+
+        constexpr void __destroy(size_type) {}
+
+        constexpr void __destroy_all() {
+            _M_size = 0;
+        }
+
+        __static_vector_array<_Tp, _Nm> _M_storage;     ///< Uninitialized element storage.
+        size_type _M_size {};                           ///< The number of live elements.
+    };
+
+    /**
+     * @brief A fixed-capacity vector container class.
+     *
+     * This class provides a variable-size container with an upper bound fixed at
+     * compile time, similar to boost::container::static_vector. Unlike
+     * cppds::array, elements live in uninitialized inline storage and are only
+     * constructed when inserted, and unlike cppds::vector, it never allocates.
+     *
+     * When the element type is trivially copyable and trivially destructible,
+     * the static_vector itself is trivially copyable. When the element type is
+     * trivial, its members are also usable in constant expressions (construct it
+     * from an initializer list or with a count and value to start a constant
+     * evaluation).
+     *
+     * @tparam _Tp The type of elements stored in the vector.
+     * @tparam _Nm The maximum number of elements.
+     */
+    template <typename _Tp, std::size_t _Nm>
+    class static_vector : protected __static_vector_storage<_Tp, _Nm> {
+    protected:
+        using __base = __static_vector_storage<_Tp, _Nm>;
+
+        static constexpr bool __trivial = std::is_trivial<_Tp>::value;
+
+    public:
+        using value_type = _Tp;             ///< The type of elements stored in the vector.
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+        using iterator = value_type *;                  ///< The iterator type.
+        using const_iterator = const value_type *;      ///< The constant iterator type.
+
+        /**
+         * @brief Default constructor. Leaves the storage uninitialized.
+         */
+        static_vector() = default;
+
+        /**
+         * @brief Constructor that fills the vector with copies of a value.
+         *
+         * @param _size The number of elements.
+         * @param _value The value to copy.
+         * @throw std::length_error if the size exceeds the capacity.
+         */
+        constexpr static_vector(size_type _size, const value_type &_value) :
+            static_vector(__init_tag()) {
+            resize(_size, _value);
+        }
+
+        /**
+         * @brief Constructor that initializes the vector from an initializer list.
+         *
+         * @param _list The initializer list to copy elements from.
+         * @throw std::length_error if the list exceeds the capacity.
+         */
+        constexpr static_vector(const std::initializer_list<value_type> &_list) :
+            static_vector(__init_tag()) {
+            operator=(_list);
+        }
+
+        /**
+         * @brief Assignment operator for initializer lists.
+         *
+         * @param _list The initializer list to copy elements from.
+         * @return A reference to the modified vector.
+         * @throw std::length_error if the list exceeds the capacity.
+         */
+        constexpr static_vector &operator=(const std::initializer_list<value_type> &_list) {
+            if (_list.size() > capacity()) {
+                throw std::length_error("static_vector capacity exceeded");
+            }
+
+            clear();
+
+            for (const value_type &value : _list) {
+                push_back(value);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Resize the vector, value-initializing new elements.
+         *
+         * @param _size The new size of the vector.
+         * @throw std::length_error if the size exceeds the capacity.
+         */
+        constexpr void resize(size_type _size) {
+            resize(_size, value_type());
+        }
+
+        /**
+         * @brief Resize the vector, copying a value into new elements.
+         *
+         * @param _size The new size of the vector.
+         * @param _value The value to copy into new elements.
+         * @throw std::length_error if the size exceeds the capacity.
+         */
+        constexpr void resize(size_type _size, const value_type &_value) {
+            if (_size > capacity()) {
+                throw std::length_error("static_vector capacity exceeded");
+            }
+
+            while (size() > _size) {
+                pop_back();
+            }
+
+            while (size() < _size) {
+                push_back(_value);
+            }
+        }
+
+        /**
+         * @brief Clear the vector (set size to 0).
+         */
+        constexpr void clear() {
+            this->__destroy_all();
+        }
+
+        /**
+         * @brief Construct an element in place at the specified index.
+         *
+         * @param _index The index at which to construct the element.
+         * @param _args The arguments forwarded to the element constructor.
+         * @return A reference to the new element.
+         * @throw std::length_error if the vector is full.
+         */
+        template <typename... _Args>
+        constexpr value_type &emplace(size_type _index, _Args &&..._args) {
+            if (full()) {
+                throw std::length_error("static_vector capacity exceeded");
+            }
+
+            if (_index == size()) {
+                this->__construct(_index, std::forward<_Args>(_args)...);
+            } else {
+                value_type value(std::forward<_Args>(_args)...);
+
+                this->__construct(size(), std::move(back()));
+
+                for (size_type i = size() - 1; i > _index; --i) {
+                    operator[](i) = std::move(operator[](i - 1));
+                }
+
+                operator[](_index) = std::move(value);
+            }
+
+            ++this->_M_size;
+
+            return operator[](_index);
+        }
+
+        /**
+         * @brief Insert an element at the specified index.
+         *
+         * @param _index The index at which to insert the element.
+         * @param _value The value to insert.
+         * @throw std::length_error if the vector is full.
+         */
+        constexpr void insert(size_type _index, const value_type &_value) {
+            emplace(_index, _value);
+        }
+
+        /**
+         * @brief Erase an element at the specified index.
+         *
+         * @param _index The index of the element to erase.
+         */
+        constexpr void erase(size_type _index) {
+            for (size_type i = _index; i + 1 < size(); ++i) {
+                operator[](i) = std::move(operator[](i + 1));
+            }
+
+            pop_back();
+        }
+
+        /**
+         * @brief Construct an element in place at the back of the vector.
+         *
+         * @param _args The arguments forwarded to the element constructor.
+         * @return A reference to the new element.
+         * @throw std::length_error if the vector is full.
+         */
+        template <typename... _Args>
+        constexpr value_type &emplace_back(_Args &&..._args) {
+            if (full()) {
+                throw std::length_error("static_vector capacity exceeded");
+            }
+
+            this->__construct(size(), std::forward<_Args>(_args)...);
+
+            return operator[](this->_M_size++);
+        }
+
+        /**
+         * @brief Add an element to the back of the vector.
+         *
+         * @param _value The value to add.
+         * @throw std::length_error if the vector is full.
+         */
+        constexpr void push_back(const value_type &_value) {
+            emplace_back(_value);
+        }
+
+        /**
+         * @brief Add an element to the back of the vector.
+         *
+         * @param _value The value to move into the vector.
+         * @throw std::length_error if the vector is full.
+         */
+        constexpr void push_back(value_type &&_value) {
+            emplace_back(std::move(_value));
+        }
+
+        /**
+         * @brief Remove the last element from the vector.
+         */
+        constexpr void pop_back() {
+            this->__destroy(--this->_M_size);
+        }
+
+        /**
+         * @brief Access the underlying data.
+         *
+         * @return A pointer to the underlying data.
+         */
+        constexpr value_type *data() {
+            return this->__data();
+        }
+
+        /**
+         * @brief Access the underlying data (const version).
+         *
+         * @return A const pointer to the underlying data.
+         */
+        constexpr const value_type *data() const {
+            return this->__data();
+        }
+
+        /**
+         * @brief Get an iterator to the first element.
+         *
+         * @return A pointer to the first element.
+         */
+        constexpr iterator begin() {
+            return data();
+        }
+
+        /**
+         * @brief Get an iterator to the first element (const version).
+         *
+         * @return A const pointer to the first element.
+         */
+        constexpr const_iterator begin() const {
+            return data();
+        }
+
+        /**
+         * @brief Get an iterator past the last element.
+         *
+         * @return A pointer past the last element.
+         */
+        constexpr iterator end() {
+            return data() + size();
+        }
+
+        /**
+         * @brief Get an iterator past the last element (const version).
+         *
+         * @return A const pointer past the last element.
+         */
+        constexpr const_iterator end() const {
+            return data() + size();
+        }
+
+        /**
+         * @brief Get the size of the vector.
+         *
+         * @return The size of the vector.
+         */
+        constexpr size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Get the maximum number of elements the vector can hold.
+         *
+         * @return The capacity of the vector.
+         */
+        static constexpr size_type capacity() {
+            return _Nm;
+        }
+
+        /**
+         * @brief Check if the vector is empty.
+         *
+         * @return True if the vector is empty, false otherwise.
+         */
+        constexpr bool empty() const {
+            return size() == 0;
+        }
+
+        /**
+         * @brief Check if the vector is full.
+         *
+         * @return True if no more elements can be added, false otherwise.
+         */
+        constexpr bool full() const {
+            return size() == capacity();
+        }
+
+        /**
+         * @brief Access the last element in the vector (const version).
+         *
+         * @return A const reference to the last element in the vector.
+         */
+        constexpr const value_type &back() const {
+            return operator[](size() - 1);
+        }
+
+        /**
+         * @brief Access the last element in the vector.
+         *
+         * @return A reference to the last element in the vector.
+         */
+        constexpr value_type &back() {
+            return operator[](size() - 1);
+        }
+
+        /**
+         * @brief Access the first element in the vector (const version).
+         *
+         * @return A const reference to the first element in the vector.
+         */
+        constexpr const value_type &front() const {
+            return operator[](0);
+        }
+
+        /**
+         * @brief Access the first element in the vector.
+         *
+         * @return A reference to the first element in the vector.
+         */
+        constexpr value_type &front() {
+            return operator[](0);
+        }
+
+        /**
+         * @brief Access an element at a specific index (const version).
+         *
+         * @param _index The index of the element to access.
+         * @return A const reference to the element at the specified index.
+         * @throw std::out_of_range if the index is out of range.
+         */
+        constexpr const value_type &at(size_type _index) const {
+            if (_index >= size()) {
+                throw std::out_of_range("index out of range");
+            }
+            return operator[](_index);
+        }
+
+        /**
+         * @brief Access an element at a specific index.
+         *
+         * @param _index The index of the element to access.
+         * @return A reference to the element at the specified index.
+         * @throw std::out_of_range if the index is out of range.
+         */
+        constexpr value_type &at(size_type _index) {
+            if (_index >= size()) {
+                throw std::out_of_range("index out of range");
+            }
+            return operator[](_index);
+        }
+
+        /**
+         * @brief Access an element at a specific index (const version).
+         *
+         * @param _index The index of the element to access.
+         * @return A const reference to the element at the specified index.
+         */
+        constexpr const value_type &operator[](size_type _index) const {
+            return data()[_index];
+        }
+
+        /**
+         * @brief Access an element at a specific index.
+         *
+         * @param _index The index of the element to access.
+         * @return A reference to the element at the specified index.
+         */
+        constexpr value_type &operator[](size_type _index) {
+            return data()[_index];
+        }
+
+    protected:
+        struct __init_tag {};
+
+        /**
+         * @brief Constructor that value-initializes trivial storage so the
+         * vector may be used in constant expressions.
+         */
+        constexpr explicit static_vector(__init_tag) :
+            static_vector(__init_tag(), std::integral_constant<bool, __trivial>()) {}
+
+        constexpr static_vector(__init_tag, std::true_type) :
+            __base(typename __base::__value_init_t()) {}
+
+        static_vector(__init_tag, std::false_type) :
+            __base() {}
+    };
+
+} // namespace cppds
@@ -0,0 +1,509 @@
+/**
+ * @file thread_pool.hpp
+ * @brief A work-stealing thread pool with fork-join parallel algorithms.
+ */
+
+#pragma once
+
+#include <atomic>               ///< For std::atomic
+#include <condition_variable>   ///< For std::condition_variable
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For std::uint64_t
+#include <exception>            ///< For std::exception_ptr
+#include <mutex>                ///< For std::mutex and std::unique_lock
+#include <thread>               ///< For std::thread
+#include <utility>              ///< For std::move
+
+#include "queue.hpp"
+#include "vector.hpp"
+#include "work_stealing_deque.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A fixed set of worker threads running fork-join tasks.
+     *
+     * Each worker owns a work_stealing_deque. A parallel algorithm splits
+     * its range in halves, pushing one half as a task and recursing into
+     * the other, so idle workers steal the largest pieces of work first.
+     * A worker waiting for a forked task to finish runs other tasks instead
+     * of blocking, which makes nested parallel calls from inside tasks
+     * cheap and keeps the number of running threads at the pool size. A
+     * call from a thread outside the pool hands the whole operation to the
+     * workers and blocks until it completes.
+     *
+     * Exceptions thrown by the callables are propagated to the caller;
+     * when several are thrown one of them is rethrown.
+     */
+    class thread_pool {
+    public:
+        using size_type = std::size_t;      ///< The type used for size-related operations.
+
+        /**
+         * @brief Constructor that starts the worker threads.
+         *
+         * @param _threads The number of workers, or 0 for one per hardware thread.
+         */
+        explicit thread_pool(size_type _threads = 0) {
+            if (_threads == 0) {
+                _threads = std::thread::hardware_concurrency();
+            }
+
+            if (_threads == 0) {
+                _threads = 1;
+            }
+
+            for (size_type i = 0; i < _threads; ++i) {
+                this->_M_workers.push_back(new __worker(i));
+            }
+
+            for (size_type i = 0; i < _threads; ++i) {
+                this->_M_workers[i]->_M_thread = std::thread(&thread_pool::__work, this, this->_M_workers[i]);
+            }
+        }
+
+        thread_pool(const thread_pool &) = delete;
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        /**
+         * @brief Destructor. Waits for running operations and stops the workers.
+         */
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock(this->_M_mutex);
+                this->_M_stop = true;
+            }
+
+            this->_M_wake.notify_all();
+
+            // Workers steal from each other until they exit.
+            for (__worker *worker : this->_M_workers) {
+                worker->_M_thread.join();
+            }
+
+            for (__worker *worker : this->_M_workers) {
+                delete worker;
+            }
+        }
+
+        /**
+         * @brief Get the process-wide pool, started on first use.
+         *
+         * @return A pool with one worker per hardware thread.
+         */
+        static thread_pool &default_pool() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        /**
+         * @brief Get the number of worker threads.
+         *
+         * @return The number of workers.
+         */
+        size_type size() const {
+            return this->_M_workers.size();
+        }
+
+        /**
+         * @brief Call a function for every index in [_first, _last) in parallel.
+         *
+         * @param _first The first index.
+         * @param _last The index past the last.
+         * @param _grain The largest number of indices a task runs
+         * sequentially, or 0 to pick one from the range and pool sizes.
+         * @param _fn The function, called as _fn(index).
+         */
+        template <typename _Fn>
+        void parallel_for(size_type _first, size_type _last, size_type _grain, _Fn &&_fn) {
+            if (_first >= _last) {
+                return;
+            }
+
+            _grain = __grain(_last - _first, _grain);
+
+            __run([&] {
+                __for(_first, _last, _grain, _fn);
+            });
+        }
+
+        /**
+         * @brief Reduce the index range [_first, _last) in parallel.
+         *
+         * The range is split into chunks of at most _grain indices, each
+         * chunk is reduced by _fn, and the partial results are combined
+         * pairwise in index order. The split only depends on the range and
+         * the grain, so with a fixed grain the result is the same on every
+         * run even for operations that are not associative, such as
+         * floating-point addition. _Tp must be copy constructible and
+         * assignable; it need not be default constructible.
+         *
+         * @param _first The first index.
+         * @param _last The index past the last.
+         * @param _grain The largest chunk, or 0 to pick one from the range and pool sizes.
+         * @param _identity The result for an empty range.
+         * @param _fn The chunk reduction, called as _fn(begin, end) and returning a _Tp.
+         * @param _combine The combination of two partial results, called as _combine(left, right).
+         * @return The reduction of the range.
+         */
+        template <typename _Tp, typename _Fn, typename _Combine>
+        _Tp parallel_reduce(size_type _first, size_type _last, size_type _grain, _Tp _identity,
+                _Fn &&_fn, _Combine &&_combine) {
+            if (_first >= _last) {
+                return _identity;
+            }
+
+            _grain = __grain(_last - _first, _grain);
+
+            _Tp result = _identity;
+
+            __run([&] {
+                result = __reduce<_Tp>(_first, _last, _grain, _identity, _fn, _combine);
+            });
+
+            return result;
+        }
+
+        /**
+         * @brief Call several functions in parallel and wait for all of them.
+         *
+         * Does nothing when called without functions.
+         *
+         * @param _fns The functions, called without arguments.
+         */
+        template <typename... _Fns>
+        void parallel_invoke(_Fns &&..._fns) {
+            if constexpr (sizeof...(_Fns) > 0) {
+                __run([&] {
+                    __invoke(_fns...);
+                });
+            }
+        }
+
+    protected:
+        /**
+         * @brief A unit of work that records its completion.
+         */
+        struct __task {
+            std::atomic<bool> _M_done {false};      // Set once the task has run
+            std::exception_ptr _M_error {};         // The exception the task threw
+            bool _M_injected = false;               // Submitted from outside the pool
+
+            virtual ~__task() = default;
+
+            virtual void __execute() = 0;
+
+            void __run() {
+                try {
+                    __execute();
+                } catch (...) {
+                    this->_M_error = std::current_exception();
+                }
+
+                this->_M_done.store(true, std::memory_order_release);
+            }
+        };
+
+        template <typename _Fn>
+        struct __fn_task : __task {
+            _Fn &_M_fn;         // The function, which outlives the task
+
+            explicit __fn_task(_Fn &_fn) : _M_fn(_fn) {}
+
+            void __execute() override {
+                this->_M_fn();
+            }
+        };
+
+        struct __worker {
+            size_type _M_index;                                 // The index of the worker
+            std::uint64_t _M_rng;                               // Victim selection state
+            work_stealing_deque<__task *> _M_deque {};          // Forked tasks
+            std::thread _M_thread {};                           // The thread
+
+            explicit __worker(size_type _index)
+                : _M_index(_index), _M_rng(0x9e3779b97f4a7c15ull * (_index + 1)) {}
+        };
+
+        // The worker running on this thread and its pool, if any.
+        static inline thread_local __worker *__current_worker = nullptr;
+        static inline thread_local thread_pool *__current_pool = nullptr;
+
+        size_type __grain(size_type _count, size_type _grain) const {
+            if (_grain != 0) {
+                return _grain;
+            }
+
+            // About eight tasks per worker balances load without much overhead.
+            size_type grain = _count / (8 * this->size());
+            return grain == 0 ? 1 : grain;
+        }
+
+        /**
+         * @brief Run a function on a worker of this pool and wait for it.
+         */
+        template <typename _Fn>
+        void __run(_Fn &&_fn) {
+            if (__current_pool == this) {
+                _fn();
+                return;
+            }
+
+            __fn_task<_Fn> task(_fn);
+            task._M_injected = true;
+
+            {
+                std::lock_guard<std::mutex> lock(this->_M_mutex);
+                this->_M_injected.push(&task);
+                this->_M_injected_count.fetch_add(1, std::memory_order_relaxed);
+                ++this->_M_signals;
+            }
+
+            this->_M_wake.notify_one();
+
+            // The caller is not a worker; sleep until the workers finish.
+            {
+                std::unique_lock<std::mutex> lock(this->_M_mutex);
+                this->_M_finished.wait(lock, [&] {
+                    return task._M_done.load(std::memory_order_acquire);
+                });
+            }
+
+            if (task._M_error) {
+                std::rethrow_exception(task._M_error);
+            }
+        }
+
+        /**
+         * @brief Make a forked task visible to idle workers.
+         */
+        void __fork(__task &_task) {
+            __current_worker->_M_deque.push(&_task);
+
+            // Pairs with the increment in __idle: either the sleeper's last
+            // scan sees the task or this load sees the sleeper.
+#if defined(__SANITIZE_THREAD__)
+            bool sleeping = this->_M_sleeping.fetch_add(0, std::memory_order_seq_cst) != 0;
+#else
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool sleeping = this->_M_sleeping.load(std::memory_order_relaxed) != 0;
+#endif
+
+            if (sleeping) {
+                {
+                    std::lock_guard<std::mutex> lock(this->_M_mutex);
+                    ++this->_M_signals;
+                }
+
+                this->_M_wake.notify_one();
+            }
+        }
+
+        /**
+         * @brief Wait for a forked task, running other tasks meanwhile.
+         */
+        void __join(__task &_task) {
+            __worker *self = __current_worker;
+
+            while (!_task._M_done.load(std::memory_order_acquire)) {
+                __task *other = nullptr;
+
+                if (self->_M_deque.pop(other) || __steal(self, other)) {
+                    other->__run();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+
+            if (_task._M_error) {
+                std::rethrow_exception(_task._M_error);
+            }
+        }
+
+        /**
+         * @brief Run _left here and _right as a forked task, then join.
+         */
+        template <typename _Left, typename _Right>
+        void __fork_join(_Left &&_left, _Right &&_right) {
+            __fn_task<_Right> right(_right);
+            __fork(right);
+
+            // The forked task refers to this frame, so it must be joined
+            // even if the left half throws.
+            std::exception_ptr error;
+
+            try {
+                _left();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            __join(right);
+
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        template <typename _Fn>
+        void __for(size_type _first, size_type _last, size_type _grain, _Fn &_fn) {
+            if (_last - _first <= _grain) {
+                for (size_type i = _first; i < _last; ++i) {
+                    _fn(i);
+                }
+
+                return;
+            }
+
+            size_type middle = _first + (_last - _first) / 2;
+
+            __fork_join(
+                [&] { __for(_first, middle, _grain, _fn); },
+                [&] { __for(middle, _last, _grain, _fn); });
+        }
+
+        template <typename _Tp, typename _Fn, typename _Combine>
+        _Tp __reduce(size_type _first, size_type _last, size_type _grain, const _Tp &_identity,
+                _Fn &_fn, _Combine &_combine) {
+            if (_last - _first <= _grain) {
+                return _fn(_first, _last);
+            }
+
+            size_type middle = _first + (_last - _first) / 2;
+            _Tp left = _identity, right = _identity;
+
+            __fork_join(
+                [&] { left = __reduce<_Tp>(_first, middle, _grain, _identity, _fn, _combine); },
+                [&] { right = __reduce<_Tp>(middle, _last, _grain, _identity, _fn, _combine); });
+
+            return _combine(std::move(left), std::move(right));
+        }
+
+        template <typename _Fn>
+        void __invoke(_Fn &_fn) {
+            _fn();
+        }
+
+        template <typename _Fn, typename... _Rest>
+        void __invoke(_Fn &_fn, _Rest &..._rest) {
+            __fork_join(_fn, [&] { __invoke(_rest...); });
+        }
+
+        bool __steal(__worker *_self, __task *&_task) {
+            size_type count = this->size();
+
+            if (count == 1) {
+                return false;
+            }
+
+            _self->_M_rng ^= _self->_M_rng << 13;
+            _self->_M_rng ^= _self->_M_rng >> 7;
+            _self->_M_rng ^= _self->_M_rng << 17;
+
+            size_type start = size_type(_self->_M_rng % count);
+
+            for (size_type i = 0; i < count; ++i) {
+                size_type victim = (start + i) % count;
+
+                if (victim != _self->_M_index && this->_M_workers[victim]->_M_deque.steal(_task)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool __take_injected(__task *&_task) {
+            if (this->_M_injected_count.load(std::memory_order_relaxed) == 0) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(this->_M_mutex);
+
+            if (this->_M_injected.empty()) {
+                return false;
+            }
+
+            _task = this->_M_injected.front();
+            this->_M_injected.pop();
+            this->_M_injected_count.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        bool __find_task(__worker *_self, __task *&_task) {
+            return _self->_M_deque.pop(_task) || __steal(_self, _task) || __take_injected(_task);
+        }
+
+        /**
+         * @brief Sleep until new work may be available. Returns false on shutdown.
+         */
+        bool __idle(__worker *_self, __task *&_task) {
+            std::unique_lock<std::mutex> lock(this->_M_mutex);
+
+            this->_M_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            std::uint64_t signals = this->_M_signals;
+
+            lock.unlock();
+            bool found = __find_task(_self, _task);
+            lock.lock();
+
+            if (!found) {
+                this->_M_wake.wait(lock, [&] {
+                    return this->_M_stop || this->_M_signals != signals;
+                });
+            }
+
+            this->_M_sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+            return found || !this->_M_stop;
+        }
+
+        void __work(__worker *_self) {
+            __current_worker = _self;
+            __current_pool = this;
+
+            while (true) {
+                __task *task = nullptr;
+                bool found = false;
+
+                // Spin briefly before sleeping; forks often arrive in bursts.
+                for (int round = 0; round < 64 && !found; ++round) {
+                    found = __find_task(_self, task);
+                    if (!found) {
+                        std::this_thread::yield();
+                    }
+                }
+
+                if (!found && !__idle(_self, task)) {
+                    return;
+                }
+
+                if (task == nullptr) {
+                    continue;
+                }
+
+                // An injected task belongs to a caller that may return as
+                // soon as it is done, so read the flag before running it.
+                bool injected = task->_M_injected;
+                task->__run();
+
+                if (injected) {
+                    // The caller waits under the mutex, so this cannot be lost.
+                    std::lock_guard<std::mutex> lock(this->_M_mutex);
+                    this->_M_finished.notify_all();
+                }
+            }
+        }
+
+        vector<__worker *> _M_workers {};                       // The workers
+        queue<__task *> _M_injected {};                         // Operations from outside the pool
+        std::atomic<size_type> _M_injected_count {0};           // The size of _M_injected
+        std::atomic<size_type> _M_sleeping {0};                 // The number of idle workers
+        std::uint64_t _M_signals = 0;                           // Bumped under the mutex to wake sleepers
+        bool _M_stop = false;                                   // Set on destruction
+        std::mutex _M_mutex {};                                 // Guards the fields above and sleeping
+        std::condition_variable _M_wake {};                     // Signals idle workers
+        std::condition_variable _M_finished {};                 // Signals external callers
+    };
+}
@@ -0,0 +1,417 @@
+/**
+ * @file timer_wheel.hpp
+ * @brief A hierarchical timer wheel with intrusive timers.
+ */
+
+#pragma once
+
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For std::uint32_t and std::uint64_t
+#include <functional>           ///< For std::function
+#include <utility>              ///< For std::move
+
+#include "array.hpp"
+
+namespace cppds {
+
+    class timer_wheel;
+
+    /**
+     * @brief A link of the intrusive, circular doubly linked slot lists.
+     */
+    struct __timer_link {
+        __timer_link *_M_prev = this;       // The previous link, or itself when unlinked
+        __timer_link *_M_next = this;       // The next link, or itself when unlinked
+
+        __timer_link() = default;
+
+        __timer_link(const __timer_link &) = delete;
+        __timer_link &operator=(const __timer_link &) = delete;
+
+        bool __linked() const {
+            return this->_M_next != this;
+        }
+
+        void __unlink() {
+            this->_M_prev->_M_next = this->_M_next;
+            this->_M_next->_M_prev = this->_M_prev;
+            this->_M_prev = this->_M_next = this;
+        }
+
+        void __link_before(__timer_link *_next) {
+            this->_M_next = _next;
+            this->_M_prev = _next->_M_prev;
+            this->_M_prev->_M_next = this;
+            _next->_M_prev = this;
+        }
+
+        /**
+         * @brief Move every link of the list headed by _head into this empty head.
+         */
+        void __take(__timer_link &_head) {
+            if (_head.__linked()) {
+                this->_M_next = _head._M_next;
+                this->_M_prev = _head._M_prev;
+                this->_M_next->_M_prev = this;
+                this->_M_prev->_M_next = this;
+                _head._M_prev = _head._M_next = &_head;
+            }
+        }
+    };
+
+    /**
+     * @brief A timer that can be scheduled on a timer_wheel.
+     *
+     * Timers are intrusive: the wheel links them into its slot lists without
+     * allocating, and the timer object itself is the handle used to cancel
+     * or reschedule it in O(1). A timer is owned by the caller, typically as
+     * a member of the object it times out, and cancels itself when it is
+     * destroyed, so it cannot be copied or moved.
+     */
+    class timer : protected __timer_link {
+    public:
+        using time_type = std::uint64_t;                ///< The type of points in time, in ticks.
+        using callback_type = std::function<void()>;    ///< The type of expiry callbacks.
+
+        /**
+         * @brief Constructor with the callback to invoke on expiry.
+         *
+         * @param _callback The callback, invoked from timer_wheel::advance.
+         */
+        explicit timer(callback_type _callback = callback_type()) : _M_callback(std::move(_callback)) {}
+
+        /**
+         * @brief Destructor. Cancels the timer if it is scheduled.
+         */
+        ~timer();
+
+        /**
+         * @brief Replace the expiry callback.
+         *
+         * @param _callback The callback, invoked from timer_wheel::advance.
+         */
+        void set_callback(callback_type _callback) {
+            this->_M_callback = std::move(_callback);
+        }
+
+        /**
+         * @brief Check if the timer is scheduled.
+         *
+         * @return `true` if the timer is waiting to expire, `false` otherwise.
+         */
+        bool scheduled() const {
+            return this->_M_wheel != nullptr;
+        }
+
+        /**
+         * @brief Get the expiry time of the timer.
+         *
+         * @return The time the timer was last scheduled for.
+         */
+        time_type expiry() const {
+            return this->_M_expiry;
+        }
+
+    protected:
+        friend class timer_wheel;
+
+        time_type _M_expiry = 0;                // The expiry time
+        timer_wheel *_M_wheel = nullptr;        // The wheel the timer is scheduled on
+        std::uint32_t _M_slot = 0;              // The index of the slot list holding the timer
+        callback_type _M_callback {};           // The expiry callback
+    };
+
+    /**
+     * @brief A hierarchical timer wheel.
+     *
+     * Time is a 64-bit tick count. Level l of the wheel has 64 slots of
+     * 64^l ticks, and a timer lives at the level of the highest 6-bit digit
+     * in which its expiry differs from the current time, in the slot of
+     * that digit. Scheduling, rescheduling and cancelling unlink and link a
+     * list node in O(1) whatever the number of timers. advance() fires the
+     * lowest level slot by slot and cascades a higher level slot into lower
+     * levels when the time reaches it, so each timer is moved at most once
+     * per level. A bitmask of occupied slots per level lets advance() jump
+     * over idle periods without visiting empty slots.
+     *
+     * The wheel is not thread-safe. Scheduling a timer that is scheduled
+     * on another wheel cancels it there first.
+     */
+    class timer_wheel {
+    public:
+        using time_type = timer::time_type;     ///< The type of points in time, in ticks.
+        using size_type = std::size_t;          ///< The type used for size-related operations.
+
+        /**
+         * @brief Constructor with the initial time.
+         *
+         * @param _now The current time.
+         */
+        explicit timer_wheel(time_type _now = 0) : _M_now(_now) {}
+
+        timer_wheel(const timer_wheel &) = delete;
+        timer_wheel &operator=(const timer_wheel &) = delete;
+
+        /**
+         * @brief Destructor. Cancels every scheduled timer without invoking it.
+         */
+        ~timer_wheel() {
+            for (size_type i = 0; i < __levels * __slots; ++i) {
+                while (this->_M_lists[i].__linked()) {
+                    timer *t = static_cast<timer *>(this->_M_lists[i]._M_next);
+                    t->__unlink();
+                    t->_M_wheel = nullptr;
+                }
+            }
+        }
+
+        /**
+         * @brief Schedule a timer, rescheduling it if it is already scheduled.
+         *
+         * A timer scheduled for the current time or earlier fires on the
+         * next call to advance().
+         *
+         * @param _timer The timer.
+         * @param _expiry The time at which the timer expires.
+         */
+        void schedule(timer &_timer, time_type _expiry) {
+            if (_timer._M_wheel == this) {
+                __unlink(_timer);
+            } else {
+                if (_timer._M_wheel != nullptr) {
+                    _timer._M_wheel->cancel(_timer);
+                }
+
+                ++this->_M_size;
+            }
+
+            _timer._M_wheel = this;
+            _timer._M_expiry = _expiry < this->_M_now ? this->_M_now : _expiry;
+            __link(_timer);
+        }
+
+        /**
+         * @brief Schedule a timer relative to the current time.
+         *
+         * @param _timer The timer.
+         * @param _delay The number of ticks from now until the timer expires.
+         */
+        void schedule_after(timer &_timer, time_type _delay) {
+            this->schedule(_timer, this->_M_now + _delay);
+        }
+
+        /**
+         * @brief Cancel a timer.
+         *
+         * @param _timer The timer.
+         * @return `true` if the timer was cancelled, `false` if it was not scheduled.
+         */
+        bool cancel(timer &_timer) {
+            if (_timer._M_wheel != this) {
+                return false;
+            }
+
+            __unlink(_timer);
+            _timer._M_wheel = nullptr;
+            --this->_M_size;
+
+            return true;
+        }
+
+        /**
+         * @brief Advance the time, invoking the callbacks of expired timers.
+         *
+         * Timers fire in order of expiry, and now() is their expiry time
+         * while their callbacks run. Callbacks may schedule, reschedule and
+         * cancel any timer, including the one that fired, and timers they
+         * schedule at or before _now fire within the same call.
+         *
+         * @param _now The new current time; earlier times are ignored.
+         * @return The number of timers that fired.
+         */
+        size_type advance(time_type _now) {
+            size_type fired = 0;
+
+            while (true) {
+                size_type level = __first_occupied_level();
+
+                if (level == __levels) {
+                    break;
+                }
+
+                size_type slot = __builtin_ctzll(this->_M_occupied[level]);
+                time_type start = __slot_start(level, slot);
+
+                if (start > _now) {
+                    break;
+                }
+
+                this->_M_now = start;
+
+                if (level == 0) {
+                    fired += __fire(slot);
+                } else {
+                    __cascade(level, slot);
+                }
+            }
+
+            if (_now > this->_M_now) {
+                this->_M_now = _now;
+            }
+
+            return fired;
+        }
+
+        /**
+         * @brief Get a lower bound on the earliest expiry.
+         *
+         * The bound is exact when the earliest timer is due within 64 ticks,
+         * and otherwise is the start of the slot holding it, which makes it
+         * a suitable timeout for a poll loop that calls advance().
+         *
+         * @return The bound, or the largest time if no timer is scheduled.
+         */
+        time_type next_expiry() const {
+            size_type level = __first_occupied_level();
+
+            if (level == __levels) {
+                return time_type(-1);
+            }
+
+            return __slot_start(level, __builtin_ctzll(this->_M_occupied[level]));
+        }
+
+        /**
+         * @brief Get the current time.
+         *
+         * @return The time of the last advance().
+         */
+        time_type now() const {
+            return this->_M_now;
+        }
+
+        /**
+         * @brief Get the number of scheduled timers.
+         *
+         * @return The number of timers waiting to expire.
+         */
+        size_type size() const {
+            return this->_M_size;
+        }
+
+        /**
+         * @brief Check if no timer is scheduled.
+         *
+         * @return `true` if the wheel is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->_M_size == 0;
+        }
+
+    protected:
+        static constexpr size_type __slot_bits = 6;
+        static constexpr size_type __slots = size_type(1) << __slot_bits;
+        static constexpr size_type __levels = (64 + __slot_bits - 1) / __slot_bits;
+
+        // The slot of timers taken out of the wheel to be fired.
+        static constexpr std::uint32_t __firing = std::uint32_t(-1);
+
+        size_type __first_occupied_level() const {
+            size_type level = 0;
+
+            while (level < __levels && this->_M_occupied[level] == 0) {
+                ++level;
+            }
+
+            return level;
+        }
+
+        /**
+         * @brief The first tick of a slot, which shares the digits above
+         * its level with the current time.
+         */
+        time_type __slot_start(size_type _level, size_type _slot) const {
+            size_type shift = _level * __slot_bits;
+            size_type above = shift + __slot_bits;
+            time_type high = above < 64 ? this->_M_now >> above << above : 0;
+
+            return high | time_type(_slot) << shift;
+        }
+
+        void __link(timer &_timer) {
+            time_type diff = _timer._M_expiry ^ this->_M_now;
+            size_type level = diff == 0 ? 0 : (63 - __builtin_clzll(diff)) / __slot_bits;
+            size_type slot = (_timer._M_expiry >> (level * __slot_bits)) & (__slots - 1);
+            size_type index = level * __slots + slot;
+
+            _timer._M_slot = std::uint32_t(index);
+            _timer.__link_before(&this->_M_lists[index]);
+            this->_M_occupied[level] |= std::uint64_t(1) << slot;
+        }
+
+        void __unlink(timer &_timer) {
+            _timer.__unlink();
+
+            if (_timer._M_slot != __firing && !this->_M_lists[_timer._M_slot].__linked()) {
+                this->_M_occupied[_timer._M_slot / __slots] &= ~(std::uint64_t(1) << (_timer._M_slot % __slots));
+            }
+        }
+
+        /**
+         * @brief Fire the timers in a level 0 slot.
+         */
+        size_type __fire(size_type _slot) {
+            __timer_link due;
+            due.__take(this->_M_lists[_slot]);
+            this->_M_occupied[0] &= ~(std::uint64_t(1) << _slot);
+
+            for (__timer_link *link = due._M_next; link != &due; link = link->_M_next) {
+                static_cast<timer *>(link)->_M_slot = __firing;
+            }
+
+            size_type fired = 0;
+
+            // Callbacks may cancel or destroy timers still in the list, so
+            // each timer is unlinked before its callback runs.
+            while (due.__linked()) {
+                timer *t = static_cast<timer *>(due._M_next);
+                t->__unlink();
+                t->_M_wheel = nullptr;
+                --this->_M_size;
+                ++fired;
+
+                if (t->_M_callback) {
+                    t->_M_callback();
+                }
+            }
+
+            return fired;
+        }
+
+        /**
+         * @brief Move the timers in a slot above level 0 to lower levels.
+         */
+        void __cascade(size_type _level, size_type _slot) {
+            __timer_link moving;
+            moving.__take(this->_M_lists[_level * __slots + _slot]);
+            this->_M_occupied[_level] &= ~(std::uint64_t(1) << _slot);
+
+            while (moving.__linked()) {
+                timer *t = static_cast<timer *>(moving._M_next);
+                t->__unlink();
+                __link(*t);
+            }
+        }
+
+        array<__timer_link, __levels * __slots> _M_lists {};    // Slot lists, level by level
+        array<std::uint64_t, __levels> _M_occupied {};          // Non-empty slots of each level
+        time_type _M_now = 0;                                   // The current time
+        size_type _M_size = 0;                                  // The number of scheduled timers
+    };
+
+    inline timer::~timer() {
+        if (this->_M_wheel != nullptr) {
+            this->_M_wheel->cancel(*this);
+        }
+    }
+}
@@ -5,27 +5,79 @@
 
 #pragma once
 
+#include <cstddef>              ///< For std::size_t and std::max_align_t
 #include <cstdlib>              ///< For and std::malloc, std::realloc and std::free
+#include <cstring>              ///< For std::memcpy and std::memmove
+#include <functional>           ///< For std::less
 #include <initializer_list>     ///< For std::initializer_list
+#include <iterator>             ///< For std::iterator_traits and std::distance
+#include <new>                  ///< For placement new and std::bad_alloc
 #include <stdexcept>            ///< For std::out_of_range exception
+#include <type_traits>          ///< For type traits of the element type
+#include <utility>              ///< For std::move
 
 #include "pair.hpp"
+#include "simd.hpp"
 
 namespace cppds {
 
+    /**
+     * @brief Tag type selecting default-initialization of new elements.
+     */
+    struct default_init_t {
+        explicit default_init_t() = default;
+    };
+
+    /**
+     * @brief Tag selecting default-initialization of new elements, e.g.
+     * `v.resize(n, cppds::default_init)`.
+     */
+    constexpr default_init_t default_init {};
+
+    template <typename T, std::size_t Align>
+    class vector;
+
+    /**
+     * @brief A vector whose storage is aligned and padded for SIMD loads.
+     *
+     * @tparam T The type of elements stored in the vector.
+     * @tparam Align The alignment of the storage in bytes, 64 by default to
+     * match a cache line and an AVX-512 register.
+     */
+    template <typename T, std::size_t Align = 64>
+    using aligned_vector = vector<T, Align>;
+
     /**
      * @brief A dynamic array (vector) container class.
      *
      * This class provides a dynamic array implementation, similar to std::vector.
      * It supports various operations such as assignment, resizing, insertion, removal, and more.
      *
+     * The storage is aligned to Align bytes and every allocation is padded to a
+     * whole number of Align-byte blocks, so a kernel may load full Align-byte
+     * vectors up to data() + size() rounded up to Align bytes without reading
+     * past the allocation. With the default alignment this is plain malloc'd
+     * storage; use cppds::aligned_vector for SIMD-friendly storage.
+     *
      * @tparam T The type of elements stored in the vector.
+     * @tparam Align The alignment of the storage in bytes, a power of two.
      */
-    template <typename T>
+    template <typename T, std::size_t Align = alignof(T)>
     class vector {
+        static_assert((Align & (Align - 1)) == 0, "alignment must be a power of two");
+        static_assert(Align >= alignof(T), "alignment must not be weaker than the element type's");
+
+    protected:
+        template <typename _It>
+        using __if_iterator = std::enable_if_t<!std::is_integral<_It>::value, int>;
+
     public:
         using value_type = T;             ///< The type of elements stored in the vector.
         using size_type = std::size_t;    ///< The type used for size-related operations.
+        using iterator = value_type *;                  ///< The iterator type.
+        using const_iterator = const value_type *;      ///< The constant iterator type.
+
+        static constexpr size_type alignment = Align;   ///< The alignment of the storage in bytes.
 
         /**
          * @brief Default constructor.
@@ -50,7 +102,19 @@ namespace cppds {
          * @param _size The size of the C-style pointer.
          */
         vector(const value_type *_pointer, size_type _size) {
-            operator=(pair<const value_type *, size_type>(_pointer, _size));
+            assign(_pointer, _pointer + _size);
+        }
+
+        /**
+         * @brief Constructor that initializes the vector from an iterator range.
+         *
+         * @tparam _InputIt The iterator type.
+         * @param _first The beginning of the range to copy elements from.
+         * @param _last The end of the range to copy elements from.
+         */
+        template <typename _InputIt, __if_iterator<_InputIt> = 0>
+        vector(_InputIt _first, _InputIt _last) {
+            assign(_first, _last);
         }
 
         /**
@@ -67,15 +131,24 @@ namespace cppds {
          *
          * @param _vector The vector to copy elements from.
          */
-        vector(const vector<value_type> &_vector) {
+        vector(const vector &_vector) {
             operator=(_vector);
         }
 
+        /**
+         * @brief Move constructor. Takes over the storage of another vector.
+         *
+         * @param _vector The vector to move elements from.
+         */
+        vector(vector &&_vector) {
+            operator=(std::move(_vector));
+        }
+
         /**
          * @brief Destructor. Clears the vector and frees memory.
          */
         ~vector() {
-            clear();
+            release();
         }
 
         /**
@@ -87,11 +160,7 @@ namespace cppds {
          */
         template <size_type N>
         vector &operator=(value_type (&_array)[N]) {
-            clear();
-
-            for (const value_type &value : _array) {
-                push_back(value);
-            }
+            assign(_array, _array + N);
 
             return *this;
         }
@@ -103,15 +172,7 @@ namespace cppds {
          * @return A reference to the modified vector.
          */
         vector &operator=(const pair<const value_type *, size_type> &_pair) {
-            const value_type *_pointer = _pair.first;
-
-            size_type _size = _pair.second;
-
-            clear();
-
-            for (size_type i = 0; i < _size; ++i) {
-                push_back(_pointer[i]);
-            }
+            assign(_pair.first, _pair.first + _pair.second);
 
             return *this;
         }
@@ -123,11 +184,7 @@ namespace cppds {
          * @return A reference to the modified vector.
          */
         vector &operator=(const std::initializer_list<value_type> &_list) {
-            clear();
-
-            for (const value_type &value : _list) {
-                push_back(value);
-            }
+            assign(_list.begin(), _list.end());
 
             return *this;
         }
@@ -138,46 +195,274 @@ namespace cppds {
          * @param _vector The vector to copy elements from.
          * @return A reference to the modified vector.
          */
-        vector &operator=(const vector<value_type> &_vector) {
-            clear();
+        vector &operator=(const vector &_vector) {
+            if (this != &_vector) {
+                assign(_vector.begin(), _vector.end());
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator for moving another vector.
+         *
+         * @param _vector The vector to move elements from. It is left empty.
+         * @return A reference to the modified vector.
+         */
+        vector &operator=(vector &&_vector) {
+            if (this != &_vector) {
+                release();
 
-            for (size_type i = 0; i < _vector.size(); ++i) {
-                push_back(_vector[i]);
+                _M_data = _vector._M_data;
+                _M_size = _vector._M_size;
+                _M_capacity = _vector._M_capacity;
+
+                _vector._M_data = nullptr;
+                _vector._M_size = 0;
+                _vector._M_capacity = 0;
             }
 
             return *this;
         }
 
+        /**
+         * @brief Replace the contents of the vector with an iterator range.
+         *
+         * The storage is reused when it is large enough, otherwise it is
+         * allocated once for the whole range.
+         *
+         * @tparam _InputIt The iterator type.
+         * @param _first The beginning of the range to copy elements from.
+         * @param _last The end of the range to copy elements from.
+         */
+        template <typename _InputIt, __if_iterator<_InputIt> = 0>
+        void assign(_InputIt _first, _InputIt _last) {
+            if (__aliases(_first)) {
+                vector copy(_first, _last);
+                operator=(std::move(copy));
+                return;
+            }
+
+            __destroy_tail(0);
+
+            append(_first, _last);
+        }
+
+        /**
+         * @brief Append an iterator range to the back of the vector.
+         *
+         * For forward iterators the final size is computed up front so at most
+         * one allocation happens; trivially copyable elements from a contiguous
+         * range are copied with std::memcpy.
+         *
+         * @tparam _InputIt The iterator type.
+         * @param _first The beginning of the range to copy elements from.
+         * @param _last The end of the range to copy elements from.
+         */
+        template <typename _InputIt, __if_iterator<_InputIt> = 0>
+        void append(_InputIt _first, _InputIt _last) {
+            insert(size(), _first, _last);
+        }
+
+        /**
+         * @brief Insert an iterator range at the specified index.
+         *
+         * @tparam _InputIt The iterator type.
+         * @param _index The index at which to insert the elements.
+         * @param _first The beginning of the range to copy elements from.
+         * @param _last The end of the range to copy elements from.
+         */
+        template <typename _InputIt, __if_iterator<_InputIt> = 0>
+        void insert(size_type _index, _InputIt _first, _InputIt _last) {
+            using category = typename std::iterator_traits<_InputIt>::iterator_category;
+
+            if constexpr (!std::is_base_of<std::forward_iterator_tag, category>::value) {
+                for (; _first != _last; ++_first) {
+                    insert(_index++, *_first);
+                }
+            } else if (__aliases(_first)) {
+                vector copy(_first, _last);
+                insert(_index, copy.begin(), copy.end());
+            } else {
+                size_type count = std::distance(_first, _last);
+
+                if (count == 0) {
+                    return;
+                }
+
+                __grow(size() + count);
+
+                __shift_tail(_index, count);
+
+                size_type constructed = size() > _index + count ? 0 : _index + count - size();
+
+                if (constructed == count) {
+                    __construct_range(_M_data + _index, _first, count);
+                } else {
+                    for (size_type i = _index; i < _index + count; ++i, ++_first) {
+                        if (i < size()) {
+                            _M_data[i] = *_first;
+                        } else {
+                            ::new (static_cast<void *>(_M_data + i)) value_type(*_first);
+                        }
+                    }
+                }
+
+                _M_size += count;
+            }
+        }
+
+        /**
+         * @brief Reserve storage for at least the specified number of elements.
+         *
+         * @param _capacity The minimum capacity of the vector.
+         */
+        void reserve(size_type _capacity) {
+            if (_capacity > capacity()) {
+                __reallocate(_capacity);
+            }
+        }
+
         /**
          * @brief Resize the vector to the specified size.
          *
+         * New elements are value-initialized (zeroed for arithmetic types).
+         *
          * @param _size The new size of the vector.
          */
         void resize(size_type _size) {
-            size_type old_size = size();
+            __grow(_size);
+
+            for (size_type i = size(); i < _size; ++i) {
+                ::new (static_cast<void *>(_M_data + i)) value_type();
+            }
+
+            __destroy_tail(_size);
+        }
+
+        /**
+         * @brief Resize the vector to the specified size.
+         *
+         * New elements are copies of the given value.
+         *
+         * @param _size The new size of the vector.
+         * @param _value The value to copy into new elements.
+         */
+        void resize(size_type _size, const value_type &_value) {
+            if (_size > size() && &_value >= data() && &_value < data() + size()) {
+                value_type value(_value);
+                resize(_size, value);
+                return;
+            }
+
+            __grow(_size);
+
+            for (size_type i = size(); i < _size; ++i) {
+                ::new (static_cast<void *>(_M_data + i)) value_type(_value);
+            }
+
+            __destroy_tail(_size);
+        }
+
+        /**
+         * @brief Resize the vector to the specified size.
+         *
+         * New elements are default-initialized, which leaves trivial types with
+         * indeterminate values instead of zero-filling them.
+         *
+         * @param _size The new size of the vector.
+         */
+        void resize(size_type _size, default_init_t) {
+            __grow(_size);
+
+            for (size_type i = size(); i < _size; ++i) {
+                ::new (static_cast<void *>(_M_data + i)) value_type;
+            }
+
+            __destroy_tail(_size);
+        }
+
+        /**
+         * @brief Resize the vector without touching new elements.
+         *
+         * Only storage is provided for new elements; their values are
+         * indeterminate until written. Fresh pages obtained from the allocator
+         * are therefore not faulted in by a memset before the caller fills them.
+         *
+         * @param _size The new size of the vector.
+         */
+        void resize_uninitialized(size_type _size) {
+            static_assert(std::is_trivially_default_constructible<value_type>::value
+                && std::is_trivially_destructible<value_type>::value,
+                "resize_uninitialized requires a trivial element type");
+
+            __grow(_size);
 
             _M_size = _size;
+        }
+
+        /**
+         * @brief Append elements written in place by a callback.
+         *
+         * Storage for up to _count elements is reserved past the end of the
+         * vector and passed to the reader as `(value_type *dest, size_type count)`.
+         * The reader returns how many elements it actually wrote, which become
+         * part of the vector; e.g. a wrapper around std::fread.
+         *
+         * @param _reader The callback that fills the tail of the vector.
+         * @param _count The maximum number of elements to append.
+         * @return The number of elements appended.
+         */
+        template <typename _Reader>
+        size_type append_from(_Reader &&_reader, size_type _count) {
+            static_assert(std::is_trivially_default_constructible<value_type>::value
+                && std::is_trivially_destructible<value_type>::value,
+                "append_from requires a trivial element type");
 
-            if (_size == 0) {
-                free(_M_data);
+            __grow(size() + _count);
 
-                _M_data = nullptr;
-                _M_size = 0;
-            } else {
-                _M_data = (value_type *)
-					realloc(_M_data, _size * sizeof(value_type));
+            size_type written = _reader(_M_data + size(), _count);
 
-                for (size_type i = _size; i < old_size; ++i) {
-                    _M_data[i].~value_type();
-                }
+            if (written > _count) {
+                written = _count;
             }
+
+            _M_size += written;
+
+            return written;
         }
 
         /**
          * @brief Clear the vector (set size to 0).
+         *
+         * The storage is kept for reuse; call release() or shrink_to_fit() to
+         * return it.
          */
         void clear() {
-            resize(0);
+            __destroy_tail(0);
+        }
+
+        /**
+         * @brief Clear the vector and free its storage.
+         */
+        void release() {
+            __destroy_tail(0);
+
+            __deallocate(_M_data);
+
+            _M_data = nullptr;
+            _M_capacity = 0;
+        }
+
+        /**
+         * @brief Reduce the capacity to the size of the vector.
+         */
+        void shrink_to_fit() {
+            if (empty()) {
+                release();
+            } else if (capacity() > size()) {
+                __reallocate(size());
+            }
         }
 
         /**
@@ -187,28 +472,152 @@ namespace cppds {
          * @param _value The value to insert.
          */
         void insert(size_type _index, const value_type &_value) {
-            resize(size() + 1);
+            value_type value(_value);
+
+            __grow(size() + 1);
+
+            if (_index == size()) {
+                ::new (static_cast<void *>(_M_data + _index)) value_type(std::move(value));
+            } else if constexpr (std::is_trivially_copyable<value_type>::value) {
+                std::memmove(static_cast<void *>(_M_data + _index + 1), _M_data + _index,
+                    (size() - _index) * sizeof(value_type));
+                ::new (static_cast<void *>(_M_data + _index)) value_type(std::move(value));
+            } else {
+                ::new (static_cast<void *>(_M_data + size())) value_type(std::move(back()));
+
+                for (size_type i = size() - 1; i > _index; --i) {
+                    operator[](i) = std::move(operator[](i - 1));
+                }
 
-            for (size_type i = _index; i < size() - 1; ++i) {
-                operator[](i + 1) = operator[](i);
+                operator[](_index) = std::move(value);
             }
 
-            operator[](_index) = _value;
+            ++_M_size;
         }
 
         /**
          * @brief Erase an element at the specified index.
          *
+         * The capacity of the vector is left unchanged.
+         *
          * @param _index The index of the element to erase.
          */
         void erase(size_type _index) {
-            operator[](_index).~value_type();
+            if constexpr (std::is_trivially_copyable<value_type>::value) {
+                std::memmove(static_cast<void *>(_M_data + _index), _M_data + _index + 1,
+                    (size() - _index - 1) * sizeof(value_type));
+            } else {
+                for (size_type i = _index; i + 1 < size(); ++i) {
+                    operator[](i) = std::move(operator[](i + 1));
+                }
+
+                back().~value_type();
+            }
+
+            --_M_size;
+        }
+
+        /**
+         * @brief Erase the elements in the index range [_first, _last).
+         *
+         * @param _first The index of the first element to erase.
+         * @param _last The index past the last element to erase.
+         */
+        void erase(size_type _first, size_type _last) {
+            if (_first == _last) {
+                return;
+            }
+
+            if constexpr (std::is_trivially_copyable<value_type>::value) {
+                std::memmove(static_cast<void *>(_M_data + _first), _M_data + _last,
+                    (size() - _last) * sizeof(value_type));
+                _M_size -= _last - _first;
+            } else {
+                for (size_type i = _last; i < size(); ++i) {
+                    _M_data[_first + i - _last] = std::move(_M_data[i]);
+                }
+
+                __destroy_tail(size() - (_last - _first));
+            }
+        }
+
+        /**
+         * @brief Erase all elements matching a predicate in a single pass.
+         *
+         * The remaining elements keep their relative order and the capacity is
+         * left unchanged. Predicates built with cppds::less_than and friends
+         * are evaluated with SIMD on arithmetic element types.
+         *
+         * @param _pred The predicate selecting the elements to erase.
+         * @return The number of erased elements.
+         */
+        template <typename _Pred>
+        size_type erase_if(_Pred _pred) {
+            size_type old_size = size();
+
+            if constexpr (__is_simd_predicate<_Pred, value_type>::value) {
+                _M_size = __compact(_M_data, size(), _pred);
+            } else if constexpr (std::is_trivially_copyable<value_type>::value) {
+                size_type out = 0;
+
+                for (size_type i = 0; i < size(); ++i) {
+                    value_type value = _M_data[i];
+                    bool erased = _pred(value);
+                    _M_data[out] = value;
+                    out += !erased;
+                }
+
+                _M_size = out;
+            } else {
+                size_type out = 0;
+
+                for (size_type i = 0; i < size(); ++i) {
+                    if (!_pred(_M_data[i])) {
+                        if (out != i) {
+                            _M_data[out] = std::move(_M_data[i]);
+                        }
+                        ++out;
+                    }
+                }
 
-            for (size_type i = _index; i < size() - 1; ++i) {
-                operator[](i) = operator[](i + 1);
+                __destroy_tail(out);
             }
 
-            resize(size() - 1);
+            return old_size - size();
+        }
+
+        /**
+         * @brief Keep only the elements matching a predicate in a single pass.
+         *
+         * @param _pred The predicate selecting the elements to keep.
+         * @return The number of erased elements.
+         */
+        template <typename _Pred>
+        size_type retain(_Pred _pred) {
+            if constexpr (__is_simd_predicate<_Pred, value_type>::value) {
+                size_type old_size = size();
+                _M_size = __compact<true>(_M_data, size(), _pred);
+                return old_size - size();
+            } else {
+                return erase_if([&_pred](const value_type &_value) {
+                    return !_pred(_value);
+                });
+            }
+        }
+
+        /**
+         * @brief Erase an element in O(1) by moving the last element into its place.
+         *
+         * The order of the remaining elements is not preserved.
+         *
+         * @param _index The index of the element to erase.
+         */
+        void swap_remove(size_type _index) {
+            if (_index + 1 != size()) {
+                operator[](_index) = std::move(back());
+            }
+
+            __destroy_tail(size() - 1);
         }
 
         /**
@@ -220,6 +629,22 @@ namespace cppds {
             insert(size(), _value);
         }
 
+        /**
+         * @brief Move an element to the back of the vector.
+         *
+         * @param _value The value to move from.
+         */
+        void push_back(value_type &&_value) {
+            // _value may be an element of this vector, which growing moves.
+            value_type value(std::move(_value));
+
+            __grow(size() + 1);
+
+            ::new (static_cast<void *>(_M_data + size())) value_type(std::move(value));
+
+            ++_M_size;
+        }
+
         /**
          * @brief Add an element to the front of the vector.
          *
@@ -261,6 +686,42 @@ namespace cppds {
             return _M_data;
         }
 
+        /**
+         * @brief Get an iterator to the first element.
+         *
+         * @return A pointer to the first element.
+         */
+        iterator begin() {
+            return data();
+        }
+
+        /**
+         * @brief Get an iterator to the first element (const version).
+         *
+         * @return A const pointer to the first element.
+         */
+        const_iterator begin() const {
+            return data();
+        }
+
+        /**
+         * @brief Get an iterator past the last element.
+         *
+         * @return A pointer past the last element.
+         */
+        iterator end() {
+            return data() + size();
+        }
+
+        /**
+         * @brief Get an iterator past the last element (const version).
+         *
+         * @return A const pointer past the last element.
+         */
+        const_iterator end() const {
+            return data() + size();
+        }
+
         /**
          * @brief Get the size of the vector.
          *
@@ -270,6 +731,28 @@ namespace cppds {
             return _M_size;
         }
 
+        /**
+         * @brief Get the number of elements the vector can hold without reallocating.
+         *
+         * @return The capacity of the vector.
+         */
+        size_type capacity() const {
+            return _M_capacity;
+        }
+
+        /**
+         * @brief Get the number of elements that may be read from data().
+         *
+         * This is size() rounded up to a whole number of Align-byte blocks,
+         * which lets vectorized kernels process the tail with full-width loads.
+         * The padding elements have indeterminate values.
+         *
+         * @return The padded size of the vector.
+         */
+        size_type padded_size() const {
+            return __padded_bytes(size()) / sizeof(value_type);
+        }
+
         /**
          * @brief Check if the vector is empty.
          *
@@ -364,8 +847,194 @@ namespace cppds {
         }
 
     protected:
-        value_type *_M_data {};  ///< The underlying data storage.
-        size_type _M_size {};    ///< The size of the vector.
+        /**
+         * @brief Grow the storage to hold at least the specified number of elements.
+         *
+         * The capacity is at least doubled so that repeated growth is amortized O(1).
+         *
+         * @param _size The number of elements that must fit.
+         */
+        void __grow(size_type _size) {
+            if (_size > capacity()) {
+                __reallocate(_size > 2 * capacity() ? _size : 2 * capacity());
+            }
+        }
+
+        /**
+         * @brief Whether the storage needs more alignment than std::malloc provides.
+         */
+        static constexpr bool __overaligned = Align > alignof(std::max_align_t);
+
+        /**
+         * @brief Get the allocation size for a capacity, padded to the alignment.
+         *
+         * @param _capacity The number of elements.
+         * @return The number of bytes to allocate.
+         */
+        static size_type __padded_bytes(size_type _capacity) {
+            return (_capacity * sizeof(value_type) + Align - 1) & ~(Align - 1);
+        }
+
+        /**
+         * @brief Allocate aligned storage.
+         *
+         * @param _bytes The number of bytes, a multiple of the alignment.
+         * @return The allocated storage.
+         * @throw std::bad_alloc if the allocation fails.
+         */
+        static value_type *__allocate(size_type _bytes) {
+            if constexpr (__overaligned) {
+                return (value_type *) ::operator new(_bytes, std::align_val_t(Align));
+            } else {
+                value_type *data = (value_type *) std::malloc(_bytes);
+
+                if (!data) {
+                    throw std::bad_alloc();
+                }
+
+                return data;
+            }
+        }
+
+        /**
+         * @brief Free storage obtained from __allocate or __reallocate.
+         *
+         * @param _data The storage to free, may be null.
+         */
+        static void __deallocate(value_type *_data) {
+            if constexpr (__overaligned) {
+                ::operator delete(_data, std::align_val_t(Align));
+            } else {
+                std::free(_data);
+            }
+        }
+
+        /**
+         * @brief Move the elements to storage of exactly the specified capacity.
+         *
+         * The capacity is rounded up to fill the padded allocation. Trivially
+         * copyable elements in malloc'd storage are relocated by std::realloc,
+         * other elements are moved into a fresh allocation.
+         *
+         * @param _capacity The new capacity, not less than size().
+         */
+        void __reallocate(size_type _capacity) {
+            size_type bytes = __padded_bytes(_capacity);
+
+            if constexpr (std::is_trivially_copyable<value_type>::value && !__overaligned) {
+                value_type *data = (value_type *) std::realloc(_M_data, bytes);
+
+                if (!data) {
+                    throw std::bad_alloc();
+                }
+
+                _M_data = data;
+            } else {
+                value_type *data = __allocate(bytes);
+
+                if constexpr (std::is_trivially_copyable<value_type>::value) {
+                    if (size()) {
+                        std::memcpy(static_cast<void *>(data), _M_data, size() * sizeof(value_type));
+                    }
+                } else {
+                    for (size_type i = 0; i < size(); ++i) {
+                        ::new (static_cast<void *>(data + i)) value_type(std::move(_M_data[i]));
+                        _M_data[i].~value_type();
+                    }
+                }
+
+                __deallocate(_M_data);
+
+                _M_data = data;
+            }
+
+            _M_capacity = bytes / sizeof(value_type);
+        }
+
+        /**
+         * @brief Check whether an iterator points into the vector's own storage.
+         *
+         * @param _it The iterator to check.
+         * @return True if the iterator is a pointer to an element of the vector.
+         */
+        template <typename _It>
+        bool __aliases(const _It &_it) const {
+            if constexpr (std::is_pointer<_It>::value) {
+                std::less<const volatile void *> less;
+                return !less(_it, _M_data) && less(_it, _M_data + size());
+            } else {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Copy-construct elements from a range into raw storage.
+         *
+         * @param _dest The uninitialized destination storage.
+         * @param _first The beginning of the range to copy elements from.
+         * @param _count The number of elements to copy.
+         */
+        template <typename _It>
+        static void __construct_range(value_type *_dest, _It _first, size_type _count) {
+            using source = std::remove_cv_t<std::remove_pointer_t<_It>>;
+
+            if constexpr (std::is_pointer<_It>::value
+                && std::is_same<source, value_type>::value
+                && std::is_trivially_copyable<value_type>::value) {
+                std::memcpy(static_cast<void *>(_dest), _first, _count * sizeof(value_type));
+            } else {
+                for (size_type i = 0; i < _count; ++i, ++_first) {
+                    ::new (static_cast<void *>(_dest + i)) value_type(*_first);
+                }
+            }
+        }
+
+        /**
+         * @brief Open a gap of the specified width at an index.
+         *
+         * The storage must already hold size() + _count elements. Elements
+         * moved past the old end are constructed; the gap is left to the caller,
+         * constructed where it lies before the old end and raw after it.
+         *
+         * @param _index The index of the gap.
+         * @param _count The width of the gap.
+         */
+        void __shift_tail(size_type _index, size_type _count) {
+            if constexpr (std::is_trivially_copyable<value_type>::value) {
+                std::memmove(static_cast<void *>(_M_data + _index + _count), _M_data + _index,
+                    (size() - _index) * sizeof(value_type));
+            } else {
+                for (size_type i = size(); i > _index; --i) {
+                    if (i - 1 + _count >= size()) {
+                        ::new (static_cast<void *>(_M_data + i - 1 + _count))
+                            value_type(std::move(_M_data[i - 1]));
+                    } else {
+                        _M_data[i - 1 + _count] = std::move(_M_data[i - 1]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Destroy the elements past the specified size and set the size to it.
+         *
+         * The size is always set, even when it grows: callers that construct
+         * elements past the old size first, such as resize(), rely on it. No
+         * element is destroyed in that case.
+         *
+         * @param _size The new size of the vector.
+         */
+        void __destroy_tail(size_type _size) {
+            for (size_type i = _size; i < size(); ++i) {
+                _M_data[i].~value_type();
+            }
+
+            _M_size = _size;
+        }
+
+        value_type *_M_data {};     ///< The underlying data storage.
+        size_type _M_size {};       ///< The size of the vector.
+        size_type _M_capacity {};   ///< The number of elements the storage can hold.
     };
 
 } // namespace cppds
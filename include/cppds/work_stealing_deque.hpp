@@ -0,0 +1,235 @@
+/**
+ * @file work_stealing_deque.hpp
+ * @brief A Chase-Lev work-stealing deque.
+ */
+
+#pragma once
+
+#include <atomic>               ///< For std::atomic
+#include <cstddef>              ///< For std::size_t
+#include <cstdint>              ///< For std::int64_t
+#include <type_traits>          ///< For std::is_trivially_copyable
+
+#include "vector.hpp"
+
+namespace cppds {
+
+    /**
+     * @brief A Chase-Lev work-stealing deque.
+     *
+     * One thread, the owner, pushes and pops at the bottom like a stack,
+     * while any number of other threads steal from the top. push() uses no
+     * read-modify-write atomics and pop() only uses one to race thieves for
+     * the last element, so the owner's fast path costs about as much as a
+     * sequential stack. Elements live in a circular array that the owner
+     * doubles when it is full; replaced arrays are kept until the deque is
+     * destroyed because a thief may still be reading from them.
+     *
+     * The memory orderings follow Lê, Pop, Cohen and Zappa Nardelli,
+     * "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP
+     * 2013), with each fence folded into the neighbouring access: push()
+     * publishes with a release store, and the store-load pairs of pop() and
+     * steal() are sequentially consistent accesses. This compiles to the
+     * same instructions on x86 and AArch64 and, unlike standalone fences,
+     * is understood by ThreadSanitizer.
+     *
+     * Elements are copied with atomic loads and stores and must be
+     * trivially copyable; task pointers and indices are the typical case.
+     *
+     * @tparam _Tp The type of elements stored in the deque.
+     */
+    template <typename _Tp>
+    class work_stealing_deque {
+        static_assert(std::is_trivially_copyable<_Tp>::value, "work_stealing_deque elements must be trivially copyable");
+
+    public:
+        using value_type = _Tp;                 ///< The type of elements stored in the deque.
+        using size_type = std::size_t;          ///< The type used for size-related operations.
+
+        /**
+         * @brief Constructor with the initial capacity.
+         *
+         * @param _capacity The initial capacity, rounded up to a power of two.
+         */
+        explicit work_stealing_deque(size_type _capacity = 256) {
+            size_type capacity = 2;
+            while (capacity < _capacity) {
+                capacity *= 2;
+            }
+
+            __ring *ring = new __ring(capacity);
+            this->_M_rings.push_back(ring);
+            this->_M_ring.store(ring, std::memory_order_relaxed);
+        }
+
+        work_stealing_deque(const work_stealing_deque &) = delete;
+        work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+        /**
+         * @brief Destructor.
+         */
+        ~work_stealing_deque() {
+            for (__ring *ring : this->_M_rings) {
+                delete ring;
+            }
+        }
+
+        /**
+         * @brief Push an element at the bottom. Owner only.
+         *
+         * @param _value The value to push.
+         */
+        void push(const value_type &_value) {
+            std::int64_t bottom = this->_M_bottom.load(std::memory_order_relaxed);
+            std::int64_t top = this->_M_top.load(std::memory_order_acquire);
+            __ring *ring = this->_M_ring.load(std::memory_order_relaxed);
+
+            if (bottom - top >= std::int64_t(ring->_M_capacity)) {
+                ring = __grow(ring, top, bottom);
+            }
+
+            ring->__put(bottom, _value);
+            this->_M_bottom.store(bottom + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Pop the most recently pushed element. Owner only.
+         *
+         * @param _value Receives the element.
+         * @return `true` if an element was popped, `false` if the deque was empty.
+         */
+        bool pop(value_type &_value) {
+            std::int64_t bottom = this->_M_bottom.load(std::memory_order_relaxed) - 1;
+            __ring *ring = this->_M_ring.load(std::memory_order_relaxed);
+
+            // Claim the bottom element before looking at top, so a thief
+            // either sees the claim or the owner sees the thief's increment.
+            this->_M_bottom.store(bottom, std::memory_order_seq_cst);
+            std::int64_t top = this->_M_top.load(std::memory_order_seq_cst);
+
+            if (top > bottom) {
+                this->_M_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            _value = ring->__get(bottom);
+
+            if (top == bottom) {
+                // The last element: race the thieves for it.
+                bool won = this->_M_top.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                this->_M_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Steal the least recently pushed element. Any thread.
+         *
+         * A steal fails both when the deque is empty and when another
+         * thread took the element first; a scheduler simply moves on to
+         * the next victim.
+         *
+         * @param _value Receives the element.
+         * @return `true` if an element was stolen, `false` otherwise.
+         */
+        bool steal(value_type &_value) {
+            std::int64_t top = this->_M_top.load(std::memory_order_seq_cst);
+            std::int64_t bottom = this->_M_bottom.load(std::memory_order_seq_cst);
+
+            if (top >= bottom) {
+                return false;
+            }
+
+            __ring *ring = this->_M_ring.load(std::memory_order_acquire);
+            value_type value = ring->__get(top);
+
+            if (!this->_M_top.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return false;
+            }
+
+            _value = value;
+
+            return true;
+        }
+
+        /**
+         * @brief Get the number of elements.
+         *
+         * The result is only a snapshot when other threads use the deque.
+         *
+         * @return The number of elements in the deque.
+         */
+        size_type size() const {
+            std::int64_t bottom = this->_M_bottom.load(std::memory_order_relaxed);
+            std::int64_t top = this->_M_top.load(std::memory_order_relaxed);
+
+            return bottom > top ? size_type(bottom - top) : 0;
+        }
+
+        /**
+         * @brief Check if the deque is empty.
+         *
+         * The result is only a snapshot when other threads use the deque.
+         *
+         * @return `true` if the deque is empty, `false` otherwise.
+         */
+        bool empty() const {
+            return this->size() == 0;
+        }
+
+        /**
+         * @brief Get the capacity of the current array. Owner only.
+         *
+         * @return The number of elements the deque holds before growing.
+         */
+        size_type capacity() const {
+            return this->_M_ring.load(std::memory_order_relaxed)->_M_capacity;
+        }
+
+    protected:
+        /**
+         * @brief A circular array indexed by the unbounded top and bottom counters.
+         */
+        struct __ring {
+            size_type _M_capacity;                  // The number of slots, a power of two
+            std::atomic<value_type> *_M_slots;      // The slots
+
+            explicit __ring(size_type _capacity)
+                : _M_capacity(_capacity), _M_slots(new std::atomic<value_type>[_capacity]) {}
+
+            ~__ring() {
+                delete[] this->_M_slots;
+            }
+
+            void __put(std::int64_t _index, const value_type &_value) {
+                this->_M_slots[size_type(_index) & (this->_M_capacity - 1)].store(_value, std::memory_order_relaxed);
+            }
+
+            value_type __get(std::int64_t _index) const {
+                return this->_M_slots[size_type(_index) & (this->_M_capacity - 1)].load(std::memory_order_relaxed);
+            }
+        };
+
+        __ring *__grow(__ring *_ring, std::int64_t _top, std::int64_t _bottom) {
+            __ring *ring = new __ring(_ring->_M_capacity * 2);
+
+            for (std::int64_t i = _top; i < _bottom; ++i) {
+                ring->__put(i, _ring->__get(i));
+            }
+
+            this->_M_rings.push_back(ring);
+            this->_M_ring.store(ring, std::memory_order_release);
+
+            return ring;
+        }
+
+        alignas(64) std::atomic<std::int64_t> _M_top {0};       // The next index to steal, advanced by thieves
+        alignas(64) std::atomic<std::int64_t> _M_bottom {0};    // The next index to push, owned by the owner
+        std::atomic<__ring *> _M_ring {nullptr};                // The current array
+        vector<__ring *> _M_rings {};                           // Every array allocated, for reclamation
+    };
+}
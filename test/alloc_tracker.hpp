@@ -0,0 +1,161 @@
+/**
+ * @file alloc_tracker.hpp
+ * @brief Heap allocation counting for the tests.
+ *
+ * Interposes malloc, calloc, realloc, aligned_alloc, posix_memalign and free
+ * to count calls and requested bytes, which also covers operator new. Include
+ * it in exactly one translation unit of a test executable. Interposition needs
+ * glibc and is disabled under sanitizers, which interpose the same functions;
+ * tests should skip their assertions when alloc_tracker::supported() is false.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define CPPDS_TEST_SANITIZED
+#endif
+#endif
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define CPPDS_TEST_SANITIZED
+#endif
+
+#if defined(__GLIBC__) && !defined(CPPDS_TEST_SANITIZED)
+#define CPPDS_TEST_ALLOC_TRACKING
+#endif
+
+namespace cppds_test {
+
+    /**
+     * @brief Process-wide allocation counters.
+     */
+    struct alloc_counters {
+        std::atomic<std::size_t> allocations {0};   ///< Calls that allocate or reallocate.
+        std::atomic<std::size_t> frees {0};         ///< Calls to free with a non-null pointer.
+        std::atomic<std::size_t> bytes {0};         ///< Bytes requested by the allocating calls.
+    };
+
+    inline alloc_counters __counters;
+
+    /**
+     * @brief Counts the heap allocations made during its lifetime.
+     */
+    class alloc_tracker {
+    public:
+        /**
+         * @brief Start counting from the current totals.
+         */
+        alloc_tracker() {
+            reset();
+        }
+
+        /**
+         * @brief Check whether allocations are counted in this build.
+         *
+         * @return True if the allocation functions are interposed.
+         */
+        static bool supported() {
+#if defined(CPPDS_TEST_ALLOC_TRACKING)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Restart counting from the current totals.
+         */
+        void reset() {
+            _M_allocations = __counters.allocations.load();
+            _M_frees = __counters.frees.load();
+            _M_bytes = __counters.bytes.load();
+        }
+
+        /**
+         * @brief Get the number of allocating calls since construction or reset().
+         *
+         * @return The number of calls to malloc, calloc, realloc, aligned_alloc and posix_memalign.
+         */
+        std::size_t allocations() const {
+            return __counters.allocations.load() - _M_allocations;
+        }
+
+        /**
+         * @brief Get the number of frees since construction or reset().
+         *
+         * @return The number of calls to free with a non-null pointer.
+         */
+        std::size_t frees() const {
+            return __counters.frees.load() - _M_frees;
+        }
+
+        /**
+         * @brief Get the number of bytes requested since construction or reset().
+         *
+         * @return The sum of the sizes passed to the allocating calls.
+         */
+        std::size_t bytes() const {
+            return __counters.bytes.load() - _M_bytes;
+        }
+
+    protected:
+        std::size_t _M_allocations {};
+        std::size_t _M_frees {};
+        std::size_t _M_bytes {};
+    };
+
+} // namespace cppds_test
+
+#if defined(CPPDS_TEST_ALLOC_TRACKING)
+extern "C" {
+    void *__libc_malloc(std::size_t);
+    void *__libc_calloc(std::size_t, std::size_t);
+    void *__libc_realloc(void *, std::size_t);
+    void *__libc_memalign(std::size_t, std::size_t);
+    void __libc_free(void *);
+
+    static inline void __cppds_test_count(std::size_t _bytes) {
+        cppds_test::__counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        cppds_test::__counters.bytes.fetch_add(_bytes, std::memory_order_relaxed);
+    }
+
+    void *malloc(std::size_t _size) {
+        __cppds_test_count(_size);
+        return __libc_malloc(_size);
+    }
+
+    void *calloc(std::size_t _count, std::size_t _size) {
+        __cppds_test_count(_count * _size);
+        return __libc_calloc(_count, _size);
+    }
+
+    void *realloc(void *_pointer, std::size_t _size) {
+        __cppds_test_count(_size);
+        return __libc_realloc(_pointer, _size);
+    }
+
+    void *aligned_alloc(std::size_t _alignment, std::size_t _size) {
+        __cppds_test_count(_size);
+        return __libc_memalign(_alignment, _size);
+    }
+
+    int posix_memalign(void **_pointer, std::size_t _alignment, std::size_t _size) {
+        __cppds_test_count(_size);
+        *_pointer = __libc_memalign(_alignment, _size);
+        return *_pointer ? 0 : ENOMEM;
+    }
+
+    void free(void *_pointer) {
+        if (_pointer) {
+            cppds_test::__counters.frees.fetch_add(1, std::memory_order_relaxed);
+        }
+        __libc_free(_pointer);
+    }
+}
+#endif
@@ -0,0 +1,199 @@
+#include <cppds/art_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename _kTp, typename _vTp>
+static void expect_same(const cppds::art_map<_kTp, _vTp> &_map, const std::map<_kTp, _vTp> &_ref) {
+    ASSERT_EQ(_map.size(), _ref.size());
+
+    auto it = _ref.begin();
+    _map.for_each([&](const _kTp &_key, const _vTp &_value) {
+        ASSERT_TRUE(it != _ref.end());
+        EXPECT_EQ(_key, it->first);
+        EXPECT_EQ(_value, it->second);
+        ++it;
+    });
+    EXPECT_TRUE(it == _ref.end());
+}
+
+/**
+ * @brief Generate a path-like key, so many keys share prefixes and some are prefixes of others.
+ */
+static std::string random_path(std::mt19937 &_rng) {
+    static const char *const parts[] = {"a", "b", "api", "v1", "users", "user", "x", "verylongsegmentname"};
+
+    std::string key;
+    unsigned length = _rng() % 5;
+
+    for (unsigned i = 0; i < length; ++i) {
+        key += '/';
+        key += parts[_rng() % 8];
+    }
+
+    if (_rng() % 2) {
+        key += std::to_string(_rng() % 100);
+    }
+
+    return key;
+}
+
+TEST(ArtMapTest, EmptyMap) {
+    cppds::art_map<std::string, int> m;
+
+    EXPECT_EQ(m.size(), 0);
+    EXPECT_TRUE(m.empty());
+
+    EXPECT_FALSE(m.contains("a"));
+    EXPECT_FALSE(m.erase("a"));
+    EXPECT_EQ(m.find("a"), nullptr);
+}
+
+TEST(ArtMapTest, InsertAndAccess) {
+    cppds::art_map<std::string, int> m = {{"apple", 1}, {"app", 2}, {"banana", 3}, {"", 4}};
+
+    EXPECT_EQ(m.size(), 4);
+
+    EXPECT_EQ(m.at("apple"), 1);
+    EXPECT_EQ(m.at("app"), 2);
+    EXPECT_EQ(m.at(""), 4);
+    EXPECT_THROW(m.at("ap"), std::out_of_range);
+
+    EXPECT_FALSE(m.insert("app", 20));
+    EXPECT_EQ(*m.find("app"), 20);
+
+    m["apricot"] += 5;
+    EXPECT_EQ(m.at("apricot"), 5);
+
+    std::vector<std::string> keys;
+    m.for_each([&](const std::string &_key, int) { keys.push_back(_key); });
+
+    EXPECT_EQ(keys, (std::vector<std::string> {"", "app", "apple", "apricot", "banana"}));
+}
+
+TEST(ArtMapTest, MatchesStdMapForStrings) {
+    cppds::art_map<std::string, int> m;
+    std::map<std::string, int> ref;
+
+    std::mt19937 rng(5);
+
+    for (int i = 0; i < 50000; ++i) {
+        std::string key = random_path(rng);
+
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(m.erase(key), ref.erase(key) == 1) << key;
+        } else {
+            EXPECT_EQ(m.insert(key, i), ref.insert_or_assign(key, i).second) << key;
+        }
+    }
+
+    expect_same(m, ref);
+
+    for (int i = 0; i < 1000; ++i) {
+        std::string key = random_path(rng);
+        EXPECT_EQ(m.contains(key), ref.count(key) == 1) << key;
+    }
+
+    while (!ref.empty()) {
+        std::string key = ref.begin()->first;
+        EXPECT_TRUE(m.erase(key)) << key;
+        ref.erase(key);
+    }
+
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(ArtMapTest, MatchesStdMapForIntegers) {
+    cppds::art_map<std::int64_t, int> m;
+    std::map<std::int64_t, int> ref;
+
+    std::mt19937_64 rng(9);
+
+    for (int i = 0; i < 100000; ++i) {
+        // Mix dense small keys, negative keys and sparse large keys.
+        std::int64_t key;
+        switch (rng() % 3) {
+        case 0: key = std::int64_t(rng() % 1000); break;
+        case 1: key = -std::int64_t(rng() % 1000); break;
+        default: key = std::int64_t(rng()); break;
+        }
+
+        if (rng() % 4 == 0) {
+            EXPECT_EQ(m.erase(key), ref.erase(key) == 1);
+        } else {
+            EXPECT_EQ(m.insert(key, i), ref.insert_or_assign(key, i).second);
+        }
+    }
+
+    expect_same(m, ref);
+}
+
+TEST(ArtMapTest, NodeGrowthAndShrink) {
+    cppds::art_map<std::uint32_t, std::uint32_t> m;
+
+    for (std::uint32_t i = 0; i < 256 * 256; ++i) {
+        m.insert(i, i);
+    }
+
+    EXPECT_EQ(m.size(), 256 * 256);
+
+    for (std::uint32_t i = 0; i < 256 * 256; i += 2) {
+        EXPECT_TRUE(m.erase(i));
+    }
+
+    EXPECT_EQ(m.size(), 128 * 256);
+
+    for (std::uint32_t i = 0; i < 256 * 256; ++i) {
+        ASSERT_EQ(m.contains(i), i % 2 == 1);
+    }
+}
+
+TEST(ArtMapTest, PrefixScan) {
+    cppds::art_map<std::string, int> m;
+    std::map<std::string, int> ref;
+
+    std::mt19937 rng(13);
+
+    for (int i = 0; i < 5000; ++i) {
+        std::string key = random_path(rng);
+        m.insert(key, i);
+        ref.insert_or_assign(key, i);
+    }
+
+    for (std::string prefix : {"", "/", "/a", "/api", "/api/v1", "/us", "/verylongsegmentname/verylong", "/q"}) {
+        auto result = m.prefix_scan(prefix);
+
+        std::vector<std::string> expected;
+        for (const auto &entry : ref) {
+            if (entry.first.compare(0, prefix.size(), prefix) == 0) {
+                expected.push_back(entry.first);
+            }
+        }
+
+        ASSERT_EQ(result.size(), expected.size()) << prefix;
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(result[i].first, expected[i]);
+            EXPECT_EQ(result[i].second, ref[expected[i]]);
+        }
+    }
+}
+
+TEST(ArtMapTest, CopyAndMove) {
+    cppds::art_map<std::string, int> m = {{"a", 1}, {"ab", 2}, {"abc", 3}};
+
+    cppds::art_map<std::string, int> copy = m;
+    m.erase("ab");
+
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy.at("ab"), 2);
+
+    cppds::art_map<std::string, int> moved = std::move(copy);
+
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_TRUE(copy.empty());
+}
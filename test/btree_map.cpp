@@ -0,0 +1,244 @@
+#include <cppds/btree_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename _Map, typename _Ref>
+static void expect_same(const _Map &_map, const _Ref &_ref) {
+    ASSERT_EQ(_map.size(), _ref.size());
+
+    auto it = _map.begin();
+    for (const auto &entry : _ref) {
+        ASSERT_TRUE(it != _map.end());
+        EXPECT_EQ(it.key(), entry.first);
+        EXPECT_EQ(it.value(), entry.second);
+        ++it;
+    }
+    EXPECT_TRUE(it == _map.end());
+}
+
+/**
+ * @brief A std::allocator that counts the live allocations.
+ */
+template <typename _Tp>
+struct counting_allocator {
+    using value_type = _Tp;
+
+    int *live;
+
+    explicit counting_allocator(int *_live) : live(_live) {}
+
+    template <typename _Up>
+    counting_allocator(const counting_allocator<_Up> &_other) : live(_other.live) {}
+
+    _Tp *allocate(std::size_t _count) {
+        ++*live;
+        return std::allocator<_Tp>().allocate(_count);
+    }
+
+    void deallocate(_Tp *_pointer, std::size_t _count) {
+        --*live;
+        std::allocator<_Tp>().deallocate(_pointer, _count);
+    }
+};
+
+TEST(BTreeMapTest, EmptyMap) {
+    cppds::btree_map<int, int> m;
+
+    EXPECT_EQ(m.size(), 0);
+    EXPECT_TRUE(m.empty());
+
+    EXPECT_FALSE(m.contains(1));
+    EXPECT_FALSE(m.erase(1));
+
+    EXPECT_TRUE(m.begin() == m.end());
+    EXPECT_TRUE(m.find(1) == m.end());
+}
+
+TEST(BTreeMapTest, InsertAndAccess) {
+    cppds::btree_map<int, std::string> m = {{3, "c"}, {1, "a"}, {2, "b"}};
+
+    EXPECT_EQ(m.size(), 3);
+
+    EXPECT_TRUE(m.insert(4, "d"));
+    EXPECT_FALSE(m.insert(1, "A"));
+
+    EXPECT_EQ(m.at(1), "A");
+    EXPECT_EQ(m.find(4).value(), "d");
+    EXPECT_THROW(m.at(5), std::out_of_range);
+
+    m[5] += "e";
+    EXPECT_EQ(m.at(5), "e");
+
+    int expected = 1;
+    for (int key : m) {
+        EXPECT_EQ(key, expected++);
+    }
+}
+
+TEST(BTreeMapTest, MatchesStdMap) {
+    cppds::btree_map<int, int> m;
+    std::map<int, int> ref;
+
+    std::mt19937 rng(7);
+
+    for (int i = 0; i < 200000; ++i) {
+        int key = int(rng() % 50000);
+
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(m.erase(key), ref.erase(key) == 1);
+        } else {
+            EXPECT_EQ(m.insert(key, i), ref.insert_or_assign(key, i).second);
+        }
+    }
+
+    expect_same(m, ref);
+
+    for (int key = -1; key <= 50001; key += 7) {
+        auto it = m.lower_bound(key);
+        auto expected = ref.lower_bound(key);
+
+        if (expected == ref.end()) {
+            EXPECT_TRUE(it == m.end());
+        } else {
+            ASSERT_TRUE(it != m.end());
+            EXPECT_EQ(it.key(), expected->first);
+        }
+
+        EXPECT_EQ(m.contains(key), ref.count(key) == 1);
+    }
+
+    while (!ref.empty()) {
+        int key = ref.begin()->first;
+        EXPECT_TRUE(m.erase(key));
+        ref.erase(key);
+    }
+
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(BTreeMapTest, GenericKeys) {
+    cppds::btree_map<std::string, int> m;
+    std::map<std::string, int> ref;
+
+    std::mt19937 rng(11);
+
+    for (int i = 0; i < 20000; ++i) {
+        std::string key = std::to_string(rng() % 5000);
+
+        if (rng() % 4 == 0) {
+            EXPECT_EQ(m.erase(key), ref.erase(key) == 1);
+        } else {
+            m[key] = i;
+            ref[key] = i;
+        }
+    }
+
+    expect_same(m, ref);
+}
+
+TEST(BTreeMapTest, BulkLoad) {
+    std::vector<cppds::pair<int, int>> sorted;
+    for (int i = 0; i < 100000; ++i) {
+        sorted.emplace_back(2 * i, i);
+    }
+
+    cppds::btree_map<int, int> m;
+    m.bulk_load(sorted.begin(), sorted.end());
+
+    EXPECT_EQ(m.size(), sorted.size());
+
+    EXPECT_EQ(m.at(0), 0);
+    EXPECT_EQ(m.at(199998), 99999);
+    EXPECT_FALSE(m.contains(3));
+
+    EXPECT_TRUE(m.insert(3, -1));
+    EXPECT_TRUE(m.erase(4));
+
+    EXPECT_EQ(m.lower_bound(3).key(), 3);
+    EXPECT_EQ(m.upper_bound(3).key(), 6);
+}
+
+TEST(BTreeMapTest, RangeScan) {
+    cppds::btree_map<int, int> m;
+    for (int i = 0; i < 10000; ++i) {
+        m.insert(i, i * 10);
+    }
+
+    long sum = 0;
+    int count = 0;
+    m.for_each(100, 200, [&](int _key, int _value) {
+        EXPECT_EQ(_value, _key * 10);
+        sum += _key;
+        ++count;
+    });
+
+    EXPECT_EQ(count, 100);
+    EXPECT_EQ(sum, (100 + 199) * 100 / 2);
+
+    count = 0;
+    m.for_each(9990, 20000, [&](int, int) { ++count; });
+    EXPECT_EQ(count, 10);
+}
+
+TEST(BTreeMapTest, ReverseIteration) {
+    cppds::btree_map<int, int> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.insert(i, i);
+    }
+
+    int expected = 999;
+    for (auto it = m.end(); it != m.begin(); ) {
+        --it;
+        EXPECT_EQ(*it, expected--);
+    }
+    EXPECT_EQ(expected, -1);
+}
+
+TEST(BTreeMapTest, CopyAndMove) {
+    cppds::btree_map<int, std::string> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.insert(i, std::to_string(i));
+    }
+
+    cppds::btree_map<int, std::string> copy = m;
+    m.erase(5);
+
+    EXPECT_EQ(copy.size(), 1000);
+    EXPECT_EQ(copy.at(5), "5");
+
+    cppds::btree_map<int, std::string> moved = std::move(copy);
+
+    EXPECT_EQ(moved.size(), 1000);
+    EXPECT_TRUE(copy.empty());
+}
+
+TEST(BTreeMapTest, Allocator) {
+    int live = 0;
+
+    {
+        using alloc = counting_allocator<cppds::pair<int, int>>;
+        cppds::btree_map<int, int, std::less<int>, alloc> m {alloc(&live)};
+
+        for (int i = 0; i < 10000; ++i) {
+            m.insert(i, i);
+        }
+
+        EXPECT_GT(live, 0);
+
+        for (int i = 0; i < 10000; ++i) {
+            m.erase(i);
+        }
+
+        EXPECT_EQ(live, 0);
+
+        m.insert(1, 1);
+    }
+
+    EXPECT_EQ(live, 0);
+}
@@ -0,0 +1,71 @@
+#include <cppds/btree_set.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+TEST(BTreeSetTest, EmptySet) {
+    cppds::btree_set<int> s;
+
+    EXPECT_EQ(s.size(), 0);
+    EXPECT_TRUE(s.empty());
+
+    EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(BTreeSetTest, InsertAndContain) {
+    cppds::btree_set<int> s = {3, 1, 2};
+
+    EXPECT_TRUE(s.insert(4));
+    EXPECT_FALSE(s.insert(1));
+
+    EXPECT_EQ(s.size(), 4);
+
+    EXPECT_TRUE(s.contains(2));
+    EXPECT_FALSE(s.contains(5));
+
+    EXPECT_EQ(*s.find(3), 3);
+}
+
+TEST(BTreeSetTest, MatchesStdSet) {
+    cppds::btree_set<unsigned> s;
+    std::set<unsigned> ref;
+
+    std::mt19937 rng(3);
+
+    for (int i = 0; i < 100000; ++i) {
+        unsigned value = rng() % 20000;
+
+        if (rng() % 2 == 0) {
+            EXPECT_EQ(s.erase(value), ref.erase(value) == 1);
+        } else {
+            EXPECT_EQ(s.insert(value), ref.insert(value).second);
+        }
+    }
+
+    ASSERT_EQ(s.size(), ref.size());
+
+    auto it = ref.begin();
+    for (unsigned value : s) {
+        EXPECT_EQ(value, *it++);
+    }
+}
+
+TEST(BTreeSetTest, BulkLoadAndScan) {
+    std::vector<int> sorted;
+    for (int i = 0; i < 5000; ++i) {
+        sorted.push_back(i * 3);
+    }
+
+    cppds::btree_set<int> s;
+    s.bulk_load(sorted.begin(), sorted.end());
+
+    EXPECT_EQ(s.size(), 5000);
+
+    std::vector<int> scanned;
+    s.for_each(10, 30, [&](int _value) { scanned.push_back(_value); });
+
+    EXPECT_EQ(scanned, (std::vector<int> {12, 15, 18, 21, 24, 27}));
+}
@@ -0,0 +1,131 @@
+#include <cppds/concurrent_skiplist_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentSkiplistMapTest, EmptyMap) {
+    cppds::concurrent_skiplist_map<int, int> m;
+
+    EXPECT_EQ(m.size(), 0);
+    EXPECT_TRUE(m.empty());
+
+    EXPECT_FALSE(m.contains(1));
+    EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(ConcurrentSkiplistMapTest, InsertAndFind) {
+    cppds::concurrent_skiplist_map<int, std::string> m;
+
+    EXPECT_TRUE(m.insert(2, "b"));
+    EXPECT_TRUE(m.insert(1, "a"));
+    EXPECT_TRUE(m.insert(3, "c"));
+    EXPECT_FALSE(m.insert(1, "A"));
+
+    EXPECT_EQ(m.size(), 3);
+
+    ASSERT_NE(m.find(1), nullptr);
+    EXPECT_EQ(*m.find(1), "a");
+    EXPECT_EQ(m.find(4), nullptr);
+
+    EXPECT_EQ(m.lower_bound(2).value(), "b");
+    EXPECT_TRUE(m.lower_bound(4) == m.end());
+}
+
+TEST(ConcurrentSkiplistMapTest, MatchesStdMap) {
+    cppds::concurrent_skiplist_map<unsigned, unsigned> m;
+    std::map<unsigned, unsigned> ref;
+
+    std::mt19937 rng(17);
+
+    for (unsigned i = 0; i < 50000; ++i) {
+        unsigned key = rng() % 100000;
+        EXPECT_EQ(m.insert(key, i), ref.emplace(key, i).second);
+    }
+
+    ASSERT_EQ(m.size(), ref.size());
+
+    auto it = m.begin();
+    for (const auto &entry : ref) {
+        ASSERT_TRUE(it != m.end());
+        EXPECT_EQ(it.key(), entry.first);
+        EXPECT_EQ(it.value(), entry.second);
+        ++it;
+    }
+    EXPECT_TRUE(it == m.end());
+}
+
+TEST(ConcurrentSkiplistMapTest, ConcurrentInsertAndScan) {
+    cppds::concurrent_skiplist_map<int, int> m;
+
+    const int writers = 4;
+    const int per_writer = 20000;
+
+    std::atomic<bool> done {false};
+    std::atomic<int> scans {0};
+
+    // Readers check that iteration stays sorted while the writers insert.
+    std::thread reader([&] {
+        while (!done.load()) {
+            int last = -1;
+            for (auto it = m.begin(); it != m.end(); ++it) {
+                EXPECT_LT(last, *it);
+                EXPECT_EQ(it.value(), *it * 2);
+                last = *it;
+            }
+            ++scans;
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < writers; ++t) {
+        threads.emplace_back([&m, t] {
+            // Interleaved keys, plus shared ones that every writer races to insert.
+            for (int i = 0; i < per_writer; ++i) {
+                m.insert(i * writers + t, (i * writers + t) * 2);
+                m.insert(-1 - i % 100 + 1000000, (-1 - i % 100 + 1000000) * 2);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    done = true;
+    reader.join();
+
+    EXPECT_GT(scans.load(), 0);
+
+    EXPECT_EQ(m.size(), size_t(writers * per_writer + 100));
+
+    for (int key = 0; key < writers * per_writer; ++key) {
+        ASSERT_TRUE(m.contains(key)) << key;
+    }
+
+    int count = 0;
+    int last = -1;
+    for (int key : m) {
+        EXPECT_LT(last, key);
+        last = key;
+        ++count;
+    }
+    EXPECT_EQ(count, writers * per_writer + 100);
+}
+
+TEST(ConcurrentSkiplistMapTest, ArenaGrowth) {
+    cppds::concurrent_skiplist_map<int, std::string> m;
+
+    std::string value(100, 'x');
+    for (int i = 0; i < 20000; ++i) {
+        m.insert(i, value);
+    }
+
+    EXPECT_GT(m.memory_usage(), 20000 * sizeof(std::string));
+    EXPECT_EQ(*m.find(19999), value);
+}
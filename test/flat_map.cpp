@@ -0,0 +1,122 @@
+#include <cppds/flat_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+TEST(FlatMapTest, EmptyMap) {
+    cppds::flat_map<int, int> m;
+
+    EXPECT_EQ(m.size(), 0);
+
+    EXPECT_TRUE(m.empty());
+}
+
+TEST(FlatMapTest, InsertAndFind) {
+    cppds::flat_map<int, std::string> m;
+
+    m.insert(3, "c");
+    m.insert(1, "a");
+    m.insert(2, "b");
+    m.insert(1, "A");
+
+    EXPECT_EQ(m.size(), 3);
+
+    EXPECT_EQ(m.keys()[0], 1);
+    EXPECT_EQ(m.keys()[2], 3);
+
+    EXPECT_EQ(m.at(1), "A");
+    EXPECT_EQ(m.values()[m.find(2)], "b");
+
+    EXPECT_EQ(m.find(4), m.size());
+    EXPECT_THROW(m.at(4), std::out_of_range);
+}
+
+TEST(FlatMapTest, BulkBuildAndMerge) {
+    cppds::flat_map<int, int> m = {{5, 50}, {1, 10}, {3, 30}, {1, 11}};
+
+    EXPECT_EQ(m.size(), 3);
+    EXPECT_EQ(m.at(1), 11);
+
+    cppds::pair<int, int> more[] = {{4, 40}, {3, 31}, {0, 0}, {4, 41}};
+    m.insert(more, more + 4);
+
+    EXPECT_EQ(m.size(), 5);
+
+    for (size_t i = 0; i < m.size(); ++i) {
+        EXPECT_EQ(m.keys()[i], int(i) + (i > 1));
+    }
+
+    EXPECT_EQ(m.at(3), 31);
+    EXPECT_EQ(m.at(4), 41);
+    EXPECT_EQ(m.at(5), 50);
+}
+
+TEST(FlatMapTest, RangeQuery) {
+    cppds::flat_map<int, int> m = {{10, 1}, {20, 2}, {30, 3}, {40, 4}};
+
+    cppds::pair<size_t, size_t> range = m.range(20, 35);
+
+    EXPECT_EQ(range.first, 1);
+    EXPECT_EQ(range.second, 3);
+
+    int sum = 0;
+    for (size_t i = range.first; i < range.second; ++i) {
+        sum += m.values()[i];
+    }
+
+    EXPECT_EQ(sum, 5);
+}
+
+TEST(FlatMapTest, Erase) {
+    cppds::flat_map<int, int> m = {{1, 10}, {2, 20}};
+
+    EXPECT_TRUE(m.erase(1));
+    EXPECT_FALSE(m.erase(1));
+
+    EXPECT_EQ(m.size(), 1);
+
+    EXPECT_TRUE(m.contains(2));
+}
+
+TEST(FlatMapTest, LargeBulkBuildKeepsLastValue) {
+    std::vector<cppds::pair<int, int>> pairs;
+    for (int i = 0; i < 10000; ++i) {
+        pairs.push_back({(i * 7919) % 1000 - 500, i});
+    }
+
+    cppds::flat_map<int, int> m;
+    m.insert(pairs.begin(), pairs.end());
+
+    EXPECT_EQ(m.size(), 1000);
+    EXPECT_EQ(m.keys()[0], -500);
+
+    for (size_t i = 0; i < m.size(); ++i) {
+        ASSERT_EQ(m.keys()[i], int(i) - 500);
+    }
+
+    // The last of the ten values of each key wins.
+    for (int i = 9000; i < 10000; ++i) {
+        ASSERT_EQ(m.at((i * 7919) % 1000 - 500), i);
+    }
+}
+
+TEST(FlatMapTest, BulkBuildTreatsSignedZerosAsEqual) {
+    std::vector<cppds::pair<double, int>> pairs;
+    for (int i = 0; i < 200; ++i) {
+        pairs.push_back({i % 2 ? -0.0 : 0.0, i});
+    }
+
+    cppds::flat_map<double, int> m;
+    m.insert(pairs.begin(), pairs.end());
+
+    EXPECT_EQ(m.size(), 1);
+    EXPECT_EQ(m.at(0.0), 199);
+
+    cppds::pair<double, int> two[] = {{0.0, 1}, {-0.0, 2}};
+    cppds::flat_map<double, int> n;
+    n.insert(two, two + 2);
+
+    EXPECT_EQ(n.at(0.0), 2);
+}
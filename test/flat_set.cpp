@@ -0,0 +1,69 @@
+#include <cppds/flat_set.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(FlatSetTest, EmptySet) {
+    cppds::flat_set<int> s;
+
+    EXPECT_EQ(s.size(), 0);
+
+    EXPECT_TRUE(s.empty());
+}
+
+TEST(FlatSetTest, InsertAndContain) {
+    cppds::flat_set<int> s;
+
+    EXPECT_TRUE(s.insert(30));
+    EXPECT_TRUE(s.insert(10));
+    EXPECT_TRUE(s.insert(20));
+    EXPECT_FALSE(s.insert(10));
+
+    EXPECT_EQ(s.size(), 3);
+
+    EXPECT_EQ(s[0], 10);
+    EXPECT_EQ(s[1], 20);
+    EXPECT_EQ(s[2], 30);
+
+    EXPECT_TRUE(s.contains(20));
+    EXPECT_FALSE(s.contains(25));
+}
+
+TEST(FlatSetTest, BulkBuildAndMerge) {
+    cppds::flat_set<int> s = {5, 1, 3, 1, 5};
+
+    EXPECT_EQ(s.size(), 3);
+
+    int more[] = {4, 2, 3, 6, 2};
+    s.insert(more, more + 5);
+
+    EXPECT_EQ(s.size(), 6);
+
+    int expected = 1;
+    for (int value : s) {
+        EXPECT_EQ(value, expected++);
+    }
+}
+
+TEST(FlatSetTest, RangeQuery) {
+    cppds::flat_set<int> s = {10, 20, 30, 40, 50};
+
+    cppds::pair<size_t, size_t> range = s.range(15, 40);
+
+    EXPECT_EQ(range.first, 1);
+    EXPECT_EQ(range.second, 3);
+
+    EXPECT_EQ(s.lower_bound(30), 2);
+    EXPECT_EQ(s.upper_bound(30), 3);
+    EXPECT_EQ(s.lower_bound(60), s.size());
+}
+
+TEST(FlatSetTest, Erase) {
+    cppds::flat_set<int> s = {10, 20};
+
+    EXPECT_TRUE(s.erase(20));
+    EXPECT_FALSE(s.erase(20));
+
+    EXPECT_EQ(s.size(), 1);
+
+    EXPECT_TRUE(s.contains(10));
+}
@@ -0,0 +1,166 @@
+#define CPPDS_HASH_STATS
+
+#include <cppds/map.hpp>
+#include <cppds/set.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(HashStatsTest, Set) {
+    cppds::set<int> s;
+
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+
+    cppds::hash_stats stats = s.stats();
+
+    EXPECT_EQ(stats.size, 100);
+    EXPECT_EQ(stats.capacity, 128);
+    EXPECT_GT(stats.rehashes, 0);
+    EXPECT_GE(stats.mean_hit_probe, 1.0);
+    EXPECT_GE(stats.mean_miss_probe, 1.0);
+    EXPECT_GT(stats.bytes_per_element, sizeof(size_t) + sizeof(int));
+
+    size_t hits = 0;
+    for (size_t count : stats.hit_probes) {
+        hits += count;
+    }
+    EXPECT_EQ(hits, 100);
+
+    size_t groups = 0;
+    for (size_t count : stats.group_occupancy) {
+        groups += count;
+    }
+    EXPECT_EQ(groups, 128 / cppds::hash_stats::group_size);
+}
+
+TEST(HashStatsTest, SetClearKeepsCapacity) {
+    cppds::set<int> s;
+
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+
+    size_t capacity = s.stats().capacity;
+
+    s.clear();
+
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.stats().capacity, capacity);
+    EXPECT_FALSE(s.contains(1));
+
+    for (int i = 0; i < 3; ++i) {
+        s.insert(i);
+    }
+
+    s.shrink_to_fit();
+
+    EXPECT_LT(s.stats().capacity, capacity);
+    EXPECT_EQ(s.size(), 3);
+    EXPECT_TRUE(s.contains(0));
+    EXPECT_TRUE(s.contains(2));
+
+    s.release();
+
+    EXPECT_EQ(s.stats().capacity, 0);
+}
+
+TEST(HashStatsTest, Map) {
+    cppds::map<int, int> m;
+
+    EXPECT_EQ(m.stats().size, 0);
+    EXPECT_EQ(m.stats().rehashes, 0);
+
+    for (int i = 0; i < 10; ++i) {
+        m.insert(i, i);
+    }
+
+    cppds::hash_stats stats = m.stats();
+
+    EXPECT_EQ(stats.size, 10);
+    EXPECT_EQ(stats.capacity, 16);
+    EXPECT_DOUBLE_EQ(stats.load_factor, 10.0 / 16.0);
+    EXPECT_LT(stats.max_displacement, stats.capacity);
+}
+
+TEST(HashStatsTest, MapClearKeepsCapacity) {
+    cppds::map<int, int> s;
+
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i, i);
+    }
+
+    size_t capacity = s.stats().capacity;
+
+    s.clear();
+
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.stats().capacity, capacity);
+    EXPECT_FALSE(s.contains(1));
+
+    for (int i = 0; i < 3; ++i) {
+        s.insert(i, i);
+    }
+
+    s.shrink_to_fit();
+
+    EXPECT_LT(s.stats().capacity, capacity);
+    EXPECT_EQ(s.size(), 3);
+    EXPECT_TRUE(s.contains(0));
+    EXPECT_TRUE(s.contains(2));
+
+    s.release();
+
+    EXPECT_EQ(s.stats().capacity, 0);
+}
+
+TEST(HashStatsTest, SwapExchangesRehashStats) {
+    cppds::set<int> a;
+    cppds::set<int> b;
+
+    for (int i = 0; i < 100; ++i) {
+        a.insert(i);
+    }
+
+    size_t rehashes = a.stats().rehashes;
+
+    EXPECT_GT(rehashes, 0);
+    EXPECT_EQ(b.stats().rehashes, 0);
+
+    a.swap(b);
+
+    EXPECT_EQ(a.stats().rehashes, 0);
+    EXPECT_EQ(b.stats().rehashes, rehashes);
+
+    cppds::map<int, int> m;
+    cppds::map<int, int> n;
+
+    for (int i = 0; i < 100; ++i) {
+        m.insert(i, i);
+    }
+
+    rehashes = m.stats().rehashes;
+
+    m.swap(n);
+
+    EXPECT_EQ(m.stats().rehashes, 0);
+    EXPECT_EQ(n.stats().rehashes, rehashes);
+}
+
+TEST(HashStatsTest, ShrinkToFitKeepsRehashHistory) {
+    cppds::set<int> s;
+
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+
+    size_t rehashes = s.stats().rehashes;
+
+    for (int i = 3; i < 100; ++i) {
+        s.erase(i);
+    }
+
+    s.shrink_to_fit();
+
+    EXPECT_EQ(s.stats().rehashes, rehashes + 1);
+}
@@ -0,0 +1,198 @@
+#include <cppds/indexed_priority_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <vector>
+
+TEST(IndexedPriorityQueueTest, EmptyQueue) {
+    cppds::indexed_priority_queue<int> q(8);
+
+    EXPECT_EQ(q.size(), 0);
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.contains(3));
+    EXPECT_FALSE(q.contains(100));
+}
+
+TEST(IndexedPriorityQueueTest, PushAndPop) {
+    cppds::indexed_priority_queue<int> q;
+
+    EXPECT_TRUE(q.push(2, 30));
+    EXPECT_TRUE(q.push(0, 10));
+    EXPECT_TRUE(q.push(7, 20));
+    EXPECT_FALSE(q.push(0, 5));
+
+    EXPECT_EQ(q.size(), 3);
+    EXPECT_EQ(q.key(0), 10);
+
+    EXPECT_EQ(q.top(), 10);
+    EXPECT_EQ(q.top_handle(), 0);
+    q.pop();
+
+    EXPECT_FALSE(q.contains(0));
+    EXPECT_EQ(q.top_handle(), 7);
+    q.pop();
+    EXPECT_EQ(q.top_handle(), 2);
+    q.pop();
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.push(0, 1));
+}
+
+TEST(IndexedPriorityQueueTest, ChangeKeys) {
+    cppds::indexed_priority_queue<int> q(4);
+
+    q.push(0, 10);
+    q.push(1, 20);
+    q.push(2, 30);
+    q.push(3, 40);
+
+    q.decrease_key(3, 5);
+    EXPECT_EQ(q.top_handle(), 3);
+    EXPECT_EQ(q.key(3), 5);
+
+    q.increase_key(3, 50);
+    EXPECT_EQ(q.top_handle(), 0);
+
+    q.update(0, 45);
+    q.update(5, 15);
+    EXPECT_EQ(q.top_handle(), 5);
+    EXPECT_EQ(q.size(), 5);
+
+    std::vector<std::size_t> order;
+    while (!q.empty()) {
+        order.push_back(q.top_handle());
+        q.pop();
+    }
+
+    EXPECT_EQ(order, (std::vector<std::size_t> {5, 1, 2, 0, 3}));
+}
+
+TEST(IndexedPriorityQueueTest, Erase) {
+    cppds::indexed_priority_queue<int, std::less<int>, 2> q;
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        q.push(i, int(i));
+    }
+
+    EXPECT_TRUE(q.erase(0));
+    EXPECT_TRUE(q.erase(4));
+    EXPECT_TRUE(q.erase(9));
+    EXPECT_FALSE(q.erase(4));
+    EXPECT_FALSE(q.erase(20));
+
+    EXPECT_EQ(q.size(), 7);
+
+    std::vector<std::size_t> order;
+    while (!q.empty()) {
+        order.push_back(q.top_handle());
+        q.pop();
+    }
+
+    EXPECT_EQ(order, (std::vector<std::size_t> {1, 2, 3, 5, 6, 7, 8}));
+}
+
+TEST(IndexedPriorityQueueTest, Clear) {
+    cppds::indexed_priority_queue<int> q;
+
+    q.push(1, 1);
+    q.push(2, 2);
+    q.clear();
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.contains(1));
+    EXPECT_TRUE(q.push(1, 3));
+}
+
+TEST(IndexedPriorityQueueTest, RandomOperationsMatchReference) {
+    std::mt19937 rng(3);
+    cppds::indexed_priority_queue<std::uint32_t> q(64);
+    std::map<std::size_t, std::uint32_t> expected;
+
+    for (int i = 0; i < 20000; ++i) {
+        std::size_t handle = rng() % 64;
+        std::uint32_t key = rng() % 1000;
+
+        switch (rng() % 3) {
+        case 0:
+            q.update(handle, key);
+            expected[handle] = key;
+            break;
+        case 1:
+            ASSERT_EQ(q.erase(handle), expected.erase(handle) == 1);
+            break;
+        case 2:
+            if (!expected.empty()) {
+                std::uint32_t smallest = q.top();
+                ASSERT_EQ(expected.at(q.top_handle()), smallest);
+                for (const auto &entry : expected) {
+                    ASSERT_LE(smallest, entry.second);
+                }
+                expected.erase(q.top_handle());
+                q.pop();
+            }
+            break;
+        }
+
+        ASSERT_EQ(q.size(), expected.size());
+    }
+}
+
+TEST(IndexedPriorityQueueTest, DijkstraMatchesLazyDeletion) {
+    constexpr std::size_t vertices = 500;
+    std::mt19937 rng(4);
+
+    std::vector<std::vector<std::pair<std::size_t, std::uint64_t>>> graph(vertices);
+    for (std::size_t i = 0; i < vertices * 8; ++i) {
+        graph[rng() % vertices].emplace_back(rng() % vertices, rng() % 100);
+    }
+
+    const std::uint64_t infinity = std::numeric_limits<std::uint64_t>::max();
+
+    std::vector<std::uint64_t> dist(vertices, infinity);
+    cppds::indexed_priority_queue<std::uint64_t> q(vertices);
+    dist[0] = 0;
+    q.push(0, 0);
+
+    while (!q.empty()) {
+        std::size_t u = q.top_handle();
+        q.pop();
+
+        for (const auto &edge : graph[u]) {
+            if (dist[u] + edge.second < dist[edge.first]) {
+                dist[edge.first] = dist[u] + edge.second;
+                q.update(edge.first, dist[edge.first]);
+            }
+        }
+    }
+
+    std::vector<std::uint64_t> expected(vertices, infinity);
+    using item = std::pair<std::uint64_t, std::size_t>;
+    std::priority_queue<item, std::vector<item>, std::greater<item>> lazy;
+    expected[0] = 0;
+    lazy.emplace(0, 0);
+
+    while (!lazy.empty()) {
+        item top = lazy.top();
+        lazy.pop();
+
+        if (top.first != expected[top.second]) {
+            continue;
+        }
+
+        for (const auto &edge : graph[top.second]) {
+            if (top.first + edge.second < expected[edge.first]) {
+                expected[edge.first] = top.first + edge.second;
+                lazy.emplace(expected[edge.first], edge.first);
+            }
+        }
+    }
+
+    EXPECT_EQ(dist, expected);
+}
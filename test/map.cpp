@@ -1,7 +1,12 @@
 #include <cppds/map.hpp>
+#include <cppds/parallel_hash_build.hpp>
 
 #include <gtest/gtest.h>
 
+#include "alloc_tracker.hpp"
+
+#include <vector>
+
 TEST(MapTest, EmptyMap) {
     cppds::map<float, int> m;
 
@@ -61,4 +66,164 @@ TEST(MapTest, Clear) {
     EXPECT_EQ(m.size(), 0);
 
     EXPECT_TRUE(m.empty());
+}
+
+TEST(MapTest, NoAllocationsOnLookup) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    cppds::map<int, int> m;
+
+    for (int i = 0; i < 1000; ++i) {
+        m.insert(i, i);
+    }
+
+    cppds_test::alloc_tracker tracker;
+
+    size_t found = 0;
+    for (int i = 0; i < 2000; ++i) {
+        found += m.contains(i);
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        m.erase(i);
+    }
+
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(tracker.frees(), 0);
+    EXPECT_GE(found, 1000);
+}
+
+TEST(MapTest, NoAllocationsOnClearAndReuse) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    cppds::map<int, int> m;
+
+    for (int i = 0; i < 100; ++i) {
+        m.insert(i, i);
+    }
+
+    cppds_test::alloc_tracker tracker;
+
+    for (int batch = 1; batch <= 10; ++batch) {
+        m.clear();
+
+        EXPECT_EQ(m.find(0), nullptr);
+
+        for (int i = 0; i < 100; ++i) {
+            m.insert(i, i * batch);
+        }
+    }
+
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(m.size(), 100);
+
+    for (int i = 0; i < 100; ++i) {
+        const int *value = m.find(i);
+
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, i * 10);
+    }
+}
+
+TEST(MapTest, FindAndForEach) {
+    cppds::map<int, int> m;
+
+    EXPECT_EQ(m.find(1), nullptr);
+
+    for (int i = 0; i < 100; ++i) {
+        m.insert(i, i * 3);
+    }
+
+    ASSERT_NE(m.find(7), nullptr);
+    EXPECT_EQ(*m.find(7), 21);
+    EXPECT_EQ(m.find(100), nullptr);
+
+    *m.find(7) = 5;
+    const cppds::map<int, int> &c = m;
+    EXPECT_EQ(*c.find(7), 5);
+
+    long keys = 0, values = 0;
+    m.for_each([&](int _key, int _value) {
+        keys += _key;
+        values += _value;
+    });
+
+    EXPECT_EQ(keys, 99 * 100 / 2);
+    EXPECT_EQ(values, 3 * 99 * 100 / 2 - 21 + 5);
+}
+
+TEST(MapTest, BuildParallel) {
+    cppds::thread_pool pool(4);
+
+    std::vector<cppds::pair<int, int>> pairs;
+    for (int i = 0; i < 100000; ++i) {
+        pairs.push_back({i, i * 2});
+    }
+    // A repeated key keeps its last value, as with insert().
+    for (int i = 0; i < 1000; ++i) {
+        pairs.push_back({i, -i});
+    }
+
+    cppds::map<int, int> m;
+    m.insert(-1, -1);
+    cppds::build_parallel(m, pairs.begin(), pairs.end(), pool);
+
+    EXPECT_EQ(m.size(), 100000);
+    EXPECT_FALSE(m.contains(-1));
+
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_TRUE(m.contains(i)) << i;
+    }
+
+    EXPECT_EQ(*m.find(0), 0);
+    EXPECT_EQ(*m.find(999), -999);
+    EXPECT_EQ(*m.find(1000), 2000);
+    EXPECT_EQ(*m.find(99999), 199998);
+
+    m.insert(100000, 1);
+    EXPECT_EQ(*m.find(100000), 1);
+}
+
+TEST(MapTest, BuildParallelWithTinyRegions) {
+    cppds::thread_pool pool(8);
+    std::vector<cppds::pair<int, int>> pairs;
+    for (int i = 0; i < 20; ++i) {
+        pairs.push_back({i % 12, i});
+    }
+
+    cppds::map<int, int> m;
+    cppds::build_parallel(m, pairs.begin(), pairs.end(), pool);
+
+    EXPECT_EQ(m.size(), 12);
+    for (int i = 0; i < 12; ++i) {
+        EXPECT_EQ(*m.find(i), i < 8 ? i + 12 : i) << i;
+    }
+}
+
+TEST(MapTest, BuildParallelCombine) {
+    cppds::thread_pool pool(4);
+    std::vector<cppds::pair<int, int>> pairs;
+    for (int i = 0; i < 50000; ++i) {
+        pairs.push_back({i % 1000, i});
+    }
+
+    cppds::map<int, long> sums;
+    cppds::build_parallel(sums, pairs.begin(), pairs.end(), [](long _a, long _b) { return _a + _b; }, pool);
+
+    EXPECT_EQ(sums.size(), 1000);
+    for (int key = 0; key < 1000; ++key) {
+        // key + (key + 1000) + ... + (key + 49000)
+        ASSERT_EQ(*sums.find(key), 50L * key + 1000L * 49 * 50 / 2) << key;
+    }
+
+    // Combining keeps the first value: the values reach it in input order.
+    cppds::map<int, long> first;
+    cppds::build_parallel(first, pairs.begin(), pairs.end(), [](long _a, long) { return _a; }, pool);
+    for (int key = 0; key < 1000; ++key) {
+        ASSERT_EQ(*first.find(key), key) << key;
+    }
 }
\ No newline at end of file
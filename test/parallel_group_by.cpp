@@ -0,0 +1,115 @@
+#include <cppds/parallel_group_by.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace {
+    struct row {
+        std::uint32_t key;
+        std::int64_t amount;
+    };
+
+    std::vector<row> make_rows(std::size_t _count, std::uint32_t _keys) {
+        std::vector<row> rows;
+        std::uint64_t state = 12345;
+
+        for (std::size_t i = 0; i < _count; ++i) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            rows.push_back({std::uint32_t(state >> 33) % _keys, std::int64_t(state >> 40) - (1 << 23)});
+        }
+
+        return rows;
+    }
+
+    auto key_amount = [](const row &_row) {
+        return cppds::pair<std::uint32_t, std::int64_t>(_row.key, _row.amount);
+    };
+}
+
+TEST(ParallelGroupByTest, Sum) {
+    cppds::thread_pool pool(4);
+    const auto rows = make_rows(200000, 5000);
+
+    std::map<std::uint32_t, std::int64_t> expected;
+    for (const row &r : rows) {
+        expected[r.key] += r.amount;
+    }
+
+    cppds::map<std::uint32_t, std::int64_t> sums;
+    cppds::parallel_group_by(rows.begin(), rows.end(), sums, key_amount,
+        [](std::int64_t _a, std::int64_t _b) { return _a + _b; }, pool);
+
+    EXPECT_EQ(sums.size(), expected.size());
+
+    for (const auto &[key, sum] : expected) {
+        const std::int64_t *value = sums.find(key);
+        ASSERT_NE(value, nullptr) << key;
+        ASSERT_EQ(*value, sum) << key;
+    }
+}
+
+TEST(ParallelGroupByTest, MinAndMax) {
+    cppds::thread_pool pool(3);
+    const auto rows = make_rows(50000, 300);
+
+    cppds::map<std::uint32_t, std::int64_t> mins, maxs;
+    cppds::parallel_group_by(rows.begin(), rows.end(), mins, key_amount,
+        [](std::int64_t _a, std::int64_t _b) { return std::min(_a, _b); }, pool);
+    cppds::parallel_group_by(rows.begin(), rows.end(), maxs, key_amount,
+        [](std::int64_t _a, std::int64_t _b) { return std::max(_a, _b); }, pool);
+
+    std::vector<std::int64_t> lo(300, std::numeric_limits<std::int64_t>::max());
+    std::vector<std::int64_t> hi(300, std::numeric_limits<std::int64_t>::min());
+    for (const row &r : rows) {
+        lo[r.key] = std::min(lo[r.key], r.amount);
+        hi[r.key] = std::max(hi[r.key], r.amount);
+    }
+
+    for (std::uint32_t key = 0; key < 300; ++key) {
+        ASSERT_EQ(*mins.find(key), lo[key]) << key;
+        ASSERT_EQ(*maxs.find(key), hi[key]) << key;
+    }
+}
+
+TEST(ParallelGroupByTest, CombinesInInputOrder) {
+    // Keeping the first value is associative but not commutative.
+    cppds::thread_pool pool(4);
+    std::vector<cppds::pair<int, int>> rows;
+    for (int i = 0; i < 100000; ++i) {
+        rows.push_back({i % 97, i});
+    }
+
+    cppds::map<int, int> first;
+    cppds::parallel_group_by(rows.begin(), rows.end(), first,
+        [](const cppds::pair<int, int> &_row) { return _row; },
+        [](int _a, int) { return _a; }, pool);
+
+    EXPECT_EQ(first.size(), 97);
+    for (int key = 0; key < 97; ++key) {
+        ASSERT_EQ(*first.find(key), key) << key;
+    }
+}
+
+TEST(ParallelGroupByTest, ReplacesContents) {
+    cppds::thread_pool pool(2);
+    std::vector<row> rows;
+
+    cppds::map<std::uint32_t, std::int64_t> sums;
+    sums.insert(1, 1);
+
+    cppds::parallel_group_by(rows.begin(), rows.end(), sums, key_amount,
+        [](std::int64_t _a, std::int64_t _b) { return _a + _b; }, pool);
+    EXPECT_TRUE(sums.empty());
+
+    rows.push_back({7, 2});
+    rows.push_back({7, 3});
+    cppds::parallel_group_by(rows.begin(), rows.end(), sums, key_amount,
+        [](std::int64_t _a, std::int64_t _b) { return _a + _b; }, pool);
+    EXPECT_EQ(sums.size(), 1);
+    EXPECT_EQ(*sums.find(7), 5);
+}
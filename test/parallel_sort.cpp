@@ -0,0 +1,148 @@
+#include <cppds/parallel_sort.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::uint64_t> random_values(std::size_t _count, std::uint64_t _modulus) {
+        std::mt19937_64 rng(_count ^ _modulus);
+        std::vector<std::uint64_t> values(_count);
+
+        for (std::uint64_t &value : values) {
+            value = rng() % _modulus;
+        }
+
+        return values;
+    }
+}
+
+TEST(ParallelSortTest, Random) {
+    cppds::thread_pool pool(4);
+
+    for (std::size_t size : {0, 1, 1000, 65535, 65536, 300001}) {
+        auto values = random_values(size, ~std::uint64_t(0));
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        cppds::parallel_sort(values.begin(), values.end(), std::less<std::uint64_t>(), pool);
+        ASSERT_EQ(values, expected) << size;
+    }
+}
+
+TEST(ParallelSortTest, Duplicates) {
+    cppds::thread_pool pool(4);
+
+    for (std::uint64_t modulus : {1, 2, 3, 10, 1000}) {
+        auto values = random_values(200000, modulus);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        cppds::parallel_sort(values.begin(), values.end(), std::less<std::uint64_t>(), pool);
+        ASSERT_EQ(values, expected) << modulus;
+    }
+}
+
+TEST(ParallelSortTest, Patterns) {
+    cppds::thread_pool pool(3);
+
+    std::vector<int> ascending(200000), descending(200000);
+    for (int i = 0; i < 200000; ++i) {
+        ascending[i] = i;
+        descending[i] = 200000 - i;
+    }
+
+    auto values = ascending;
+    cppds::parallel_sort(values.begin(), values.end(), std::less<int>(), pool);
+    EXPECT_EQ(values, ascending);
+
+    values = descending;
+    cppds::parallel_sort(values.begin(), values.end(), std::less<int>(), pool);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+
+    cppds::parallel_sort(values.begin(), values.end(), std::greater<int>(), pool);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<int>()));
+}
+
+TEST(ParallelSortTest, NonArithmetic) {
+    cppds::thread_pool pool(4);
+
+    std::vector<std::string> values;
+    for (std::uint64_t value : random_values(100000, 5000)) {
+        values.push_back(std::to_string(value));
+    }
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    cppds::parallel_sort(values.begin(), values.end(), std::less<std::string>(), pool);
+    EXPECT_EQ(values, expected);
+}
+
+TEST(ParallelSortTest, CppdsVectorWithDefaultPool) {
+    cppds::vector<std::uint64_t> values;
+    for (std::uint64_t value : random_values(100000, 1000000)) {
+        values.push_back(value);
+    }
+
+    cppds::parallel_sort(values.begin(), values.end());
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST(ParallelStableSortTest, IsStable) {
+    struct record {
+        std::uint32_t key;
+        std::uint32_t payload;
+    };
+
+    auto by_key = [](const record &_a, const record &_b) { return _a.key < _b.key; };
+
+    for (std::size_t workers : {2, 3, 4, 8}) {
+        cppds::thread_pool pool(workers);
+
+        std::vector<record> records;
+        auto keys = random_values(250001, 100);
+        for (std::uint32_t i = 0; i < keys.size(); ++i) {
+            records.push_back({std::uint32_t(keys[i]), i});
+        }
+
+        auto expected = records;
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+
+        cppds::parallel_stable_sort(records.begin(), records.end(), by_key, pool);
+
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            ASSERT_EQ(records[i].key, expected[i].key) << workers << " " << i;
+            ASSERT_EQ(records[i].payload, expected[i].payload) << workers << " " << i;
+        }
+    }
+}
+
+TEST(ParallelStableSortTest, Random) {
+    cppds::thread_pool pool(4);
+
+    for (std::size_t size : {0, 1, 1000, 65536, 300001}) {
+        auto values = random_values(size, ~std::uint64_t(0));
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        cppds::parallel_stable_sort(values.begin(), values.end(), std::less<std::uint64_t>(), pool);
+        ASSERT_EQ(values, expected) << size;
+    }
+
+    std::vector<std::string> strings;
+    for (std::uint64_t value : random_values(100000, 5000)) {
+        strings.push_back(std::to_string(value));
+    }
+
+    auto expected = strings;
+    std::sort(expected.begin(), expected.end());
+
+    cppds::parallel_stable_sort(strings.begin(), strings.end());
+    EXPECT_EQ(strings, expected);
+}
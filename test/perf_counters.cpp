@@ -0,0 +1,35 @@
+#include <cppds/perf_counters.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+TEST(PerfCountersTest, Names) {
+    EXPECT_STREQ(cppds::perf_counters::name(cppds::perf_counters::cycles), "cycles");
+    EXPECT_STREQ(cppds::perf_counters::name(cppds::perf_counters::dtlb_misses), "dtlb_misses");
+}
+
+TEST(PerfCountersTest, StartStop) {
+    cppds::perf_counters counters;
+
+    counters.start();
+
+    volatile unsigned sum = 0;
+    for (unsigned i = 0; i < 100000; ++i) {
+        sum += i;
+    }
+
+    counters.stop();
+
+    if (counters.available(cppds::perf_counters::instructions)) {
+        EXPECT_GT(counters.value(cppds::perf_counters::instructions), 100000u);
+    } else {
+        EXPECT_EQ(counters.value(cppds::perf_counters::instructions), 0u);
+    }
+
+    counters.reset();
+
+    for (size_t i = 0; i < cppds::perf_counters::event_count; ++i) {
+        EXPECT_EQ(counters.value(cppds::perf_counters::event(i)), 0u);
+    }
+}
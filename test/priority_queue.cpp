@@ -0,0 +1,198 @@
+#include <cppds/priority_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(PriorityQueueTest, EmptyQueue) {
+    cppds::priority_queue<int> q;
+
+    EXPECT_EQ(q.size(), 0);
+
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, PushAndPop) {
+    cppds::priority_queue<int> q;
+
+    q.push(3);
+    q.push(7);
+    q.push(1);
+    q.push(5);
+
+    EXPECT_EQ(q.size(), 4);
+
+    EXPECT_EQ(q.top(), 7);
+    q.pop();
+    EXPECT_EQ(q.top(), 5);
+    q.pop();
+    EXPECT_EQ(q.top(), 3);
+    q.pop();
+    EXPECT_EQ(q.top(), 1);
+    q.pop();
+
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, MinQueue) {
+    cppds::priority_queue<int, std::greater<int>> q = {4, 2, 8, 6};
+
+    EXPECT_EQ(q.top(), 2);
+    q.pop();
+    EXPECT_EQ(q.top(), 4);
+}
+
+TEST(PriorityQueueTest, HeapifyMatchesStd) {
+    std::mt19937 rng(1);
+    std::vector<int> values(1000);
+
+    for (int &value : values) {
+        value = int(rng() % 100);
+    }
+
+    cppds::priority_queue<int, std::less<int>, 3> q(values.begin(), values.end());
+    std::priority_queue<int> expected(values.begin(), values.end());
+
+    EXPECT_EQ(q.size(), values.size());
+
+    while (!expected.empty()) {
+        ASSERT_EQ(q.top(), expected.top());
+        q.pop();
+        expected.pop();
+    }
+
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, PushPop) {
+    cppds::priority_queue<int> q = {5, 3, 1};
+
+    EXPECT_EQ(q.push_pop(9), 9);
+    EXPECT_EQ(q.size(), 3);
+
+    EXPECT_EQ(q.push_pop(4), 5);
+    EXPECT_EQ(q.size(), 3);
+    EXPECT_EQ(q.top(), 4);
+
+    cppds::priority_queue<int> empty;
+    EXPECT_EQ(empty.push_pop(2), 2);
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(PriorityQueueTest, ReplaceTop) {
+    cppds::priority_queue<int> q = {5, 3, 1};
+
+    EXPECT_EQ(q.replace_top(9), 5);
+    EXPECT_EQ(q.top(), 9);
+
+    EXPECT_EQ(q.replace_top(0), 9);
+    EXPECT_EQ(q.top(), 3);
+    EXPECT_EQ(q.size(), 3);
+}
+
+TEST(PriorityQueueTest, PopN) {
+    cppds::priority_queue<int> q = {4, 9, 1, 7, 3, 8};
+
+    std::vector<int> out;
+    q.pop_n(2, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector<int> {9, 8}));
+    EXPECT_EQ(q.size(), 4);
+    EXPECT_EQ(q.top(), 7);
+
+    q.pop_n(10, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector<int> {9, 8, 7, 4, 3, 1}));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, RandomOperationsMatchStd) {
+    std::mt19937 rng(2);
+    cppds::priority_queue<int> q;
+    std::priority_queue<int> expected;
+
+    for (int i = 0; i < 20000; ++i) {
+        int value = int(rng() % 1000);
+
+        switch (rng() % 4) {
+        case 0:
+        case 1:
+            q.push(value);
+            expected.push(value);
+            break;
+        case 2:
+            if (!expected.empty()) {
+                q.pop();
+                expected.pop();
+            }
+            break;
+        case 3:
+            expected.push(value);
+            ASSERT_EQ(q.push_pop(value), expected.top());
+            expected.pop();
+            break;
+        }
+
+        ASSERT_EQ(q.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(q.top(), expected.top());
+        }
+    }
+}
+
+TEST(PriorityQueueTest, NonTrivialElements) {
+    cppds::priority_queue<std::string, std::greater<std::string>> q;
+
+    for (const char *word : {"pear", "apple", "fig", "banana", "cherry"}) {
+        q.push(word);
+    }
+
+    std::vector<std::string> out;
+    q.pop_n(3, std::back_inserter(out));
+
+    EXPECT_EQ(out, (std::vector<std::string> {"apple", "banana", "cherry"}));
+    EXPECT_EQ(q.top(), "fig");
+}
+
+namespace {
+    int copies = 0;
+
+    struct counted {
+        int value;
+
+        explicit counted(int _value) : value(_value) {}
+
+        counted(const counted &_other) : value(_other.value) {
+            ++copies;
+        }
+
+        counted(counted &&) = default;
+        counted &operator=(const counted &) = default;
+        counted &operator=(counted &&) = default;
+
+        bool operator<(const counted &_other) const {
+            return value < _other.value;
+        }
+    };
+}
+
+TEST(PriorityQueueTest, PushCopiesOnce) {
+    cppds::priority_queue<counted> q;
+    q.reserve(16);
+
+    for (int i = 0; i < 16; ++i) {
+        counted value(i);
+
+        copies = 0;
+        q.push(value);
+
+        EXPECT_EQ(copies, 1);
+    }
+
+    EXPECT_EQ(q.top().value, 15);
+}
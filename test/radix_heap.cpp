@@ -0,0 +1,130 @@
+#include <cppds/radix_heap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(RadixHeapTest, EmptyHeap) {
+    cppds::radix_heap<std::uint32_t, int> h;
+
+    EXPECT_EQ(h.size(), 0);
+
+    EXPECT_TRUE(h.empty());
+}
+
+TEST(RadixHeapTest, PushAndPop) {
+    cppds::radix_heap<std::uint32_t, int> h;
+
+    h.push(30, 3);
+    h.push(10, 1);
+    h.push(20, 2);
+    h.push(1000000, 4);
+
+    EXPECT_EQ(h.size(), 4);
+
+    EXPECT_EQ(h.top(), 10);
+    EXPECT_EQ(h.top_value(), 1);
+    h.pop();
+
+    EXPECT_EQ(h.top(), 20);
+    EXPECT_EQ(h.top_value(), 2);
+
+    h.push(25, 5);
+    h.pop();
+    EXPECT_EQ(h.top(), 25);
+    EXPECT_EQ(h.top_value(), 5);
+    h.pop();
+    EXPECT_EQ(h.top(), 30);
+    h.pop();
+    EXPECT_EQ(h.top(), 1000000);
+    h.pop();
+
+    EXPECT_TRUE(h.empty());
+}
+
+TEST(RadixHeapTest, EqualKeys) {
+    cppds::radix_heap<std::uint64_t, int> h;
+
+    h.push(5, 0);
+    h.push(7, 1);
+    h.push(5, 2);
+    h.push(5, 3);
+
+    int values = 0;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(h.top(), 5);
+        values |= 1 << h.top_value();
+        h.pop();
+    }
+
+    EXPECT_EQ(values, 0b1101);
+    EXPECT_EQ(h.top(), 7);
+    EXPECT_EQ(h.top_value(), 1);
+}
+
+TEST(RadixHeapTest, ExtremeKeys) {
+    cppds::radix_heap<std::uint64_t, int> h;
+
+    h.push(UINT64_MAX, 2);
+    h.push(0, 0);
+    h.push(UINT64_MAX - 1, 1);
+
+    EXPECT_EQ(h.top(), 0);
+    h.pop();
+    EXPECT_EQ(h.top(), UINT64_MAX - 1);
+    h.pop();
+    EXPECT_EQ(h.top(), UINT64_MAX);
+    h.pop();
+
+    EXPECT_TRUE(h.empty());
+}
+
+TEST(RadixHeapTest, ClearRestarts) {
+    cppds::radix_heap<std::uint8_t, int> h;
+
+    h.push(200, 0);
+    h.pop();
+    EXPECT_EQ(h.last_key(), 200);
+
+    h.clear();
+    h.push(3, 1);
+
+    EXPECT_EQ(h.top(), 3);
+}
+
+TEST(RadixHeapTest, MonotoneWorkloadMatchesStd) {
+    std::mt19937 rng(5);
+    cppds::radix_heap<std::uint32_t, std::string> h;
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>, std::greater<std::uint32_t>> expected;
+
+    std::uint32_t now = 0;
+
+    for (int i = 0; i < 50000; ++i) {
+        if (expected.empty() || rng() % 3 != 0) {
+            std::uint32_t key = now + rng() % 5000;
+            h.push(key, std::to_string(key));
+            expected.push(key);
+        } else {
+            ASSERT_EQ(h.top(), expected.top());
+            ASSERT_EQ(h.top_value(), std::to_string(expected.top()));
+            now = h.top();
+            h.pop();
+            expected.pop();
+        }
+
+        ASSERT_EQ(h.size(), expected.size());
+    }
+
+    while (!expected.empty()) {
+        ASSERT_EQ(h.top(), expected.top());
+        h.pop();
+        expected.pop();
+    }
+
+    EXPECT_TRUE(h.empty());
+}
@@ -1,7 +1,13 @@
+#include <cppds/parallel_hash_build.hpp>
 #include <cppds/set.hpp>
 
 #include <gtest/gtest.h>
 
+#include "alloc_tracker.hpp"
+
+#include <iterator>
+#include <vector>
+
 TEST(SetTest, EmptySet) {
     cppds::set<int> s;
 
@@ -61,4 +67,104 @@ TEST(SetTest, Clear) {
     EXPECT_EQ(s.size(), 0);
 
     EXPECT_TRUE(s.empty());
+}
+
+TEST(SetTest, NoAllocationsOnLookup) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    cppds::set<int> s;
+
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+
+    cppds_test::alloc_tracker tracker;
+
+    size_t found = 0;
+    for (int i = 0; i < 2000; ++i) {
+        found += s.contains(i);
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        s.erase(i);
+    }
+
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(tracker.frees(), 0);
+    EXPECT_GE(found, 1000);
+}
+
+TEST(SetTest, NoAllocationsOnClearAndReuse) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    cppds::set<int> s;
+
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+
+    cppds_test::alloc_tracker tracker;
+
+    for (int batch = 0; batch < 10; ++batch) {
+        s.clear();
+        for (int i = 0; i < 100; ++i) {
+            s.insert(i);
+        }
+    }
+
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(s.size(), 100);
+}
+
+TEST(SetTest, BuildParallel) {
+    cppds::thread_pool pool(4);
+
+    std::vector<int> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.push_back(i * 7);
+    }
+    // Duplicates collapse to one element.
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i * 7);
+    }
+
+    cppds::set<int> s {-1, -2};
+    cppds::build_parallel(s, values.begin(), values.end(), pool);
+
+    EXPECT_EQ(s.size(), 100000);
+    EXPECT_FALSE(s.contains(-1));
+
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_TRUE(s.contains(i * 7)) << i;
+        ASSERT_FALSE(s.contains(i * 7 + 1)) << i;
+    }
+
+    // The set stays usable afterwards.
+    s.insert(-5);
+    s.erase(0);
+    EXPECT_TRUE(s.contains(-5));
+    EXPECT_FALSE(s.contains(0));
+    EXPECT_EQ(s.size(), 100000);
+
+    cppds::build_parallel(s, values.begin(), values.begin(), pool);
+    EXPECT_TRUE(s.empty());
+}
+
+TEST(SetTest, BuildParallelWithTinyRegions) {
+    // More partitions than elements, so most probes leave their region.
+    cppds::thread_pool pool(8);
+    int values[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+
+    cppds::set<int> s;
+    cppds::build_parallel(s, std::begin(values), std::end(values), pool);
+
+    EXPECT_EQ(s.size(), 9);
+    for (int i = 1; i <= 9; ++i) {
+        EXPECT_TRUE(s.contains(i)) << i;
+    }
+    EXPECT_FALSE(s.contains(0));
 }
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include <cppds/sort.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    template <typename _Tp>
+    std::vector<_Tp> random_values(std::size_t _count, std::uint64_t _seed, _Tp _low, _Tp _high) {
+        std::mt19937_64 rng(_seed);
+        std::vector<_Tp> values(_count);
+
+        for (_Tp &value : values) {
+            if constexpr (std::is_floating_point<_Tp>::value) {
+                value = std::uniform_real_distribution<_Tp>(_low, _high)(rng);
+            }
+            else {
+                value = std::uniform_int_distribution<_Tp>(_low, _high)(rng);
+            }
+        }
+
+        return values;
+    }
+
+    // Inputs that defeat naive quicksorts, for sizes around the thresholds.
+    std::vector<std::vector<int>> patterns() {
+        std::vector<std::vector<int>> result;
+
+        for (int size : {0, 1, 2, 3, 23, 24, 25, 127, 128, 129, 1000, 100000}) {
+            std::vector<int> ascending(size), descending(size), organ(size), sawtooth(size), equal(size, 7);
+
+            for (int i = 0; i < size; ++i) {
+                ascending[i] = i;
+                descending[i] = size - i;
+                organ[i] = i < size / 2 ? i : size - i;
+                sawtooth[i] = i % 16;
+            }
+
+            std::vector<int> almost = ascending;
+            if (size > 10) {
+                std::swap(almost[3], almost[size - 4]);
+            }
+
+            result.push_back(ascending);
+            result.push_back(descending);
+            result.push_back(organ);
+            result.push_back(sawtooth);
+            result.push_back(equal);
+            result.push_back(almost);
+            result.push_back(random_values<int>(size, size, 0, size));
+        }
+
+        return result;
+    }
+}
+
+TEST(SortTest, Patterns) {
+    for (std::vector<int> values : patterns()) {
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        cppds::sort(values.begin(), values.end());
+        ASSERT_EQ(values, expected) << values.size();
+    }
+}
+
+TEST(SortTest, Comparators) {
+    auto values = random_values<double>(50000, 1, -1e6, 1e6);
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<double>());
+
+    cppds::sort(values.begin(), values.end(), std::greater<double>());
+    EXPECT_EQ(values, expected);
+
+    // A custom comparator takes the branching partition.
+    auto by_abs = [](double _a, double _b) { return std::abs(_a) < std::abs(_b); };
+    std::sort(expected.begin(), expected.end(), by_abs);
+    cppds::sort(values.begin(), values.end(), by_abs);
+    EXPECT_EQ(values, expected);
+}
+
+TEST(SortTest, NonArithmetic) {
+    std::vector<std::string> values;
+    for (int value : random_values<int>(5000, 2, 0, 1000)) {
+        values.push_back("key" + std::to_string(value));
+    }
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    cppds::sort(values.begin(), values.end());
+    EXPECT_EQ(values, expected);
+}
+
+TEST(SortTest, CppdsVector) {
+    cppds::vector<std::uint64_t> values;
+    for (std::uint64_t value : random_values<std::uint64_t>(100000, 3, 0, 1000000)) {
+        values.push_back(value);
+    }
+
+    cppds::sort(values.begin(), values.end());
+
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST(RadixSortTest, Unsigned) {
+    for (std::size_t size : {0, 1, 63, 64, 1000, 100000}) {
+        auto values = random_values<std::uint32_t>(size, size, 0, std::numeric_limits<std::uint32_t>::max());
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        cppds::radix_sort(values.begin(), values.end());
+        ASSERT_EQ(values, expected) << size;
+    }
+}
+
+TEST(RadixSortTest, DigitWidths) {
+    auto values = random_values<std::uint64_t>(200000, 4, 0, std::numeric_limits<std::uint64_t>::max());
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    auto sorted = values;
+    cppds::radix_sort<8>(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted, expected);
+
+    sorted = values;
+    cppds::radix_sort<11>(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted, expected);
+
+    sorted = values;
+    cppds::radix_sort<16>(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted, expected);
+}
+
+TEST(RadixSortTest, Signed) {
+    auto values = random_values<std::int64_t>(100000, 5, std::numeric_limits<std::int64_t>::min(),
+        std::numeric_limits<std::int64_t>::max());
+    values.push_back(0);
+    values.push_back(-1);
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    cppds::radix_sort(values.begin(), values.end());
+    EXPECT_EQ(values, expected);
+
+    auto small = random_values<std::int16_t>(10000, 6, -30000, 30000);
+    auto small_expected = small;
+    std::sort(small_expected.begin(), small_expected.end());
+
+    cppds::radix_sort(small.begin(), small.end());
+    EXPECT_EQ(small, small_expected);
+}
+
+TEST(RadixSortTest, FloatingPoint) {
+    auto floats = random_values<float>(100000, 7, -1e30f, 1e30f);
+    floats.push_back(0.0f);
+    floats.push_back(-std::numeric_limits<float>::infinity());
+    floats.push_back(std::numeric_limits<float>::infinity());
+    floats.push_back(std::numeric_limits<float>::denorm_min());
+    floats.push_back(-std::numeric_limits<float>::denorm_min());
+
+    auto expected = floats;
+    std::sort(expected.begin(), expected.end());
+
+    cppds::radix_sort(floats.begin(), floats.end());
+    EXPECT_EQ(floats, expected);
+
+    auto doubles = random_values<double>(100000, 8, -1.0, 1.0);
+    auto doubles_expected = doubles;
+    std::sort(doubles_expected.begin(), doubles_expected.end());
+
+    cppds::radix_sort(doubles.begin(), doubles.end());
+    EXPECT_EQ(doubles, doubles_expected);
+
+    // -0.0 orders before +0.0.
+    std::vector<double> zeros(100, 0.0);
+    zeros[50] = -0.0;
+    cppds::radix_sort(zeros.begin(), zeros.end());
+    EXPECT_TRUE(std::signbit(zeros[0]));
+    EXPECT_FALSE(std::signbit(zeros[1]));
+}
+
+TEST(RadixSortTest, KeyExtractorIsStable) {
+    struct record {
+        std::uint32_t key;
+        std::uint32_t payload;
+    };
+
+    std::vector<record> records;
+    auto keys = random_values<std::uint32_t>(100000, 9, 0, 1000);
+    for (std::uint32_t i = 0; i < keys.size(); ++i) {
+        records.push_back({keys[i], i});
+    }
+
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [](const record &_a, const record &_b) {
+        return _a.key < _b.key;
+    });
+
+    cppds::radix_sort(records.begin(), records.end(), [](const record &_r) { return _r.key; });
+
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        ASSERT_EQ(records[i].key, expected[i].key) << i;
+        ASSERT_EQ(records[i].payload, expected[i].payload) << i;
+    }
+
+    // Sorting by a negated key gives descending order.
+    cppds::radix_sort(records.begin(), records.end(), [](const record &_r) { return -std::int64_t(_r.key); });
+    EXPECT_TRUE(std::is_sorted(records.begin(), records.end(), [](const record &_a, const record &_b) {
+        return _a.key > _b.key;
+    }));
+}
@@ -0,0 +1,122 @@
+#include <cppds/static_search_index.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+template <typename _Index, typename _Tp>
+static void expect_matches_lower_bound(const std::vector<_Tp> &_sorted, const std::vector<_Tp> &_queries) {
+    _Index index(_sorted.begin(), _sorted.end());
+
+    EXPECT_EQ(index.size(), _sorted.size());
+
+    for (const _Tp &query : _queries) {
+        auto it = std::lower_bound(_sorted.begin(), _sorted.end(), query);
+        EXPECT_EQ(index.lower_bound(query), size_t(it - _sorted.begin())) << "query " << query;
+        EXPECT_EQ(index.contains(query), it != _sorted.end() && *it == query) << "query " << query;
+    }
+}
+
+template <typename _Index>
+static void check_sizes() {
+    using value_type = typename _Index::value_type;
+
+    std::mt19937 rng(42);
+
+    for (size_t size : {0, 1, 2, 15, 16, 17, 100, 272, 1000, 4913, 10000}) {
+        std::vector<value_type> sorted(size);
+        for (value_type &value : sorted) {
+            value = value_type(rng() % (3 * size + 1));
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        std::vector<value_type> queries;
+        for (size_t i = 0; i <= 3 * size + 2; ++i) {
+            queries.push_back(value_type(i));
+        }
+
+        expect_matches_lower_bound<_Index>(sorted, queries);
+    }
+}
+
+TEST(StaticSearchIndexTest, EmptyIndex) {
+    cppds::static_search_index<int> index;
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(5), 0);
+    EXPECT_FALSE(index.contains(5));
+}
+
+TEST(StaticSearchIndexTest, LowerBound) {
+    cppds::static_search_index<int> index = {10, 20, 30, 40, 50};
+
+    EXPECT_EQ(index.size(), 5);
+
+    EXPECT_EQ(index.lower_bound(5), 0);
+    EXPECT_EQ(index.lower_bound(10), 0);
+    EXPECT_EQ(index.lower_bound(11), 1);
+    EXPECT_EQ(index.lower_bound(50), 4);
+    EXPECT_EQ(index.lower_bound(51), 5);
+
+    EXPECT_TRUE(index.contains(30));
+    EXPECT_FALSE(index.contains(35));
+}
+
+TEST(StaticSearchIndexTest, MatchesStdLowerBound) {
+    check_sizes<cppds::static_search_index<std::uint32_t>>();
+    check_sizes<cppds::static_search_index<std::int64_t>>();
+    check_sizes<cppds::static_search_index<double>>();
+}
+
+TEST(StaticSearchIndexTest, Duplicates) {
+    cppds::static_search_index<int> index = {1, 2, 2, 2, 3, 3, 7};
+
+    EXPECT_EQ(index.lower_bound(2), 1);
+    EXPECT_EQ(index.lower_bound(3), 4);
+    EXPECT_EQ(index.lower_bound(4), 6);
+}
+
+TEST(StaticSearchTreeTest, EmptyIndex) {
+    cppds::static_search_tree<int> index;
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(5), 0);
+    EXPECT_FALSE(index.contains(5));
+}
+
+TEST(StaticSearchTreeTest, LowerBound) {
+    cppds::static_search_tree<int> index = {10, 20, 30, 40, 50};
+
+    EXPECT_EQ(index.size(), 5);
+
+    EXPECT_EQ(index.lower_bound(5), 0);
+    EXPECT_EQ(index.lower_bound(10), 0);
+    EXPECT_EQ(index.lower_bound(11), 1);
+    EXPECT_EQ(index.lower_bound(50), 4);
+    EXPECT_EQ(index.lower_bound(51), 5);
+
+    EXPECT_TRUE(index.contains(30));
+    EXPECT_FALSE(index.contains(35));
+}
+
+TEST(StaticSearchTreeTest, MatchesStdLowerBound) {
+    check_sizes<cppds::static_search_tree<std::uint32_t>>();
+    check_sizes<cppds::static_search_tree<std::int32_t>>();
+    check_sizes<cppds::static_search_tree<float>>();
+    check_sizes<cppds::static_search_tree<std::int64_t>>();
+}
+
+TEST(StaticSearchTreeTest, Duplicates) {
+    std::vector<int> sorted(100, 5);
+    sorted.push_back(9);
+
+    cppds::static_search_tree<int> index(sorted.begin(), sorted.end());
+
+    EXPECT_EQ(index.lower_bound(5), 0);
+    EXPECT_EQ(index.lower_bound(6), 100);
+    EXPECT_EQ(index.lower_bound(9), 100);
+    EXPECT_EQ(index.lower_bound(10), 101);
+}
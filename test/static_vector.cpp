@@ -0,0 +1,144 @@
+#include <cppds/static_vector.hpp>
+
+#include <cppds/pair.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<cppds::static_vector<int, 8>>::value,
+    "static_vector of trivial type must be trivially copyable");
+
+static_assert(std::is_trivially_copyable<cppds::static_vector<cppds::pair<int, int>, 8>>::value,
+    "static_vector of trivially copyable type must be trivially copyable");
+
+static_assert(!std::is_trivially_copyable<cppds::static_vector<std::string, 8>>::value,
+    "static_vector of non-trivial type must not be trivially copyable");
+
+constexpr cppds::static_vector<int, 8> make_squares() {
+    cppds::static_vector<int, 8> v = {0};
+    for (int i = 1; i < 5; ++i) {
+        v.push_back(i * i);
+    }
+    v.erase(0);
+    return v;
+}
+
+TEST(StaticVectorTest, EmptyVector) {
+    cppds::static_vector<int, 4> v;
+
+    EXPECT_EQ(v.size(), 0);
+    EXPECT_EQ(v.capacity(), 4);
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(StaticVectorTest, PushAndAccess) {
+    cppds::static_vector<int, 4> v;
+
+    v.push_back(10);
+    v.push_back(20);
+    v.emplace_back(30);
+
+    EXPECT_EQ(v.size(), 3);
+
+    EXPECT_EQ(v[0], 10);
+    EXPECT_EQ(v[1], 20);
+    EXPECT_EQ(v[2], 30);
+}
+
+TEST(StaticVectorTest, Overflow) {
+    cppds::static_vector<int, 2> v = {1, 2};
+
+    EXPECT_TRUE(v.full());
+    EXPECT_THROW(v.push_back(3), std::length_error);
+    EXPECT_THROW(v.at(2), std::out_of_range);
+}
+
+TEST(StaticVectorTest, InsertErase) {
+    cppds::static_vector<std::string, 8> v = {"a", "c"};
+
+    v.insert(1, "b");
+    v.insert(0, "_");
+
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v[0], "_");
+    EXPECT_EQ(v[1], "a");
+    EXPECT_EQ(v[2], "b");
+    EXPECT_EQ(v[3], "c");
+
+    v.erase(0);
+    v.pop_back();
+
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[1], "b");
+
+    cppds::static_vector<std::string, 8> copy = v;
+
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy[1], "b");
+}
+
+TEST(StaticVectorTest, Constexpr) {
+    constexpr cppds::static_vector<int, 8> v = make_squares();
+
+    static_assert(v.size() == 4, "constexpr size");
+    static_assert(v[0] == 1 && v[3] == 16, "constexpr elements");
+
+    EXPECT_EQ(v.back(), 16);
+}
+
+TEST(StaticVectorTest, Memcpy) {
+    cppds::static_vector<int, 4> v = {1, 2, 3};
+    cppds::static_vector<int, 4> w;
+
+    std::memcpy(&w, &v, sizeof(v));
+
+    EXPECT_EQ(w.size(), 3);
+    EXPECT_EQ(w[2], 3);
+}
+
+namespace {
+    int default_constructions = 0;
+
+    struct counted {
+        int value;
+
+        counted() : value(0) {
+            ++default_constructions;
+        }
+
+        explicit counted(int _value) : value(_value) {}
+    };
+}
+
+TEST(StaticVectorTest, TriviallyCopyableNotTrivial) {
+    static_assert(std::is_trivially_copyable<counted>::value && !std::is_trivial<counted>::value,
+        "counted must be trivially copyable but not trivial");
+
+    cppds::static_vector<counted, 16> v;
+
+    EXPECT_EQ(default_constructions, 0);
+
+    v.emplace_back(1);
+    v.emplace_back(2);
+    v.emplace(0, 3);
+
+    EXPECT_EQ(default_constructions, 0);
+
+    cppds::static_vector<counted, 16> w;
+    std::memcpy(&w, &v, sizeof(v));
+
+    ASSERT_EQ(w.size(), 3);
+    EXPECT_EQ(w[0].value, 3);
+    EXPECT_EQ(w[1].value, 1);
+    EXPECT_EQ(w[2].value, 2);
+
+    cppds::static_vector<cppds::pair<int, int>, 4> p = {cppds::pair<int, int>(1, 2)};
+    cppds::static_vector<cppds::pair<int, int>, 4> q = p;
+
+    ASSERT_EQ(q.size(), 1);
+    EXPECT_EQ(q[0].second, 2);
+}
@@ -0,0 +1,169 @@
+#include <cppds/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(ThreadPoolTest, Size) {
+    cppds::thread_pool pool(3);
+
+    EXPECT_EQ(pool.size(), 3);
+
+    EXPECT_GE(cppds::thread_pool::default_pool().size(), 1);
+}
+
+TEST(ThreadPoolTest, ParallelForVisitsEachIndexOnce) {
+    cppds::thread_pool pool(4);
+    std::vector<std::atomic<int>> visits(10000);
+
+    pool.parallel_for(0, visits.size(), 7, [&](std::size_t i) {
+        visits[i].fetch_add(1);
+    });
+
+    for (std::size_t i = 0; i < visits.size(); ++i) {
+        ASSERT_EQ(visits[i].load(), 1) << i;
+    }
+
+    pool.parallel_for(5, 5, 0, [](std::size_t) { FAIL(); });
+}
+
+TEST(ThreadPoolTest, ParallelForOverVector) {
+    cppds::thread_pool pool(4);
+    cppds::vector<std::uint64_t> v;
+    v.resize(100000);
+
+    pool.parallel_for(0, v.size(), 0, [&](std::size_t i) {
+        v[i] = i * i;
+    });
+
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v[i], i * i);
+    }
+}
+
+TEST(ThreadPoolTest, ParallelReduce) {
+    cppds::thread_pool pool(4);
+
+    std::uint64_t sum = pool.parallel_reduce(0, 1000001, 1000, std::uint64_t(0),
+        [](std::size_t _begin, std::size_t _end) {
+            std::uint64_t partial = 0;
+            for (std::size_t i = _begin; i < _end; ++i) {
+                partial += i;
+            }
+            return partial;
+        },
+        [](std::uint64_t _a, std::uint64_t _b) { return _a + _b; });
+
+    EXPECT_EQ(sum, std::uint64_t(1000000) * 1000001 / 2);
+
+    EXPECT_EQ(pool.parallel_reduce(3, 3, 0, 42, [](std::size_t, std::size_t) { return 0; },
+        [](int _a, int _b) { return _a + _b; }), 42);
+}
+
+TEST(ThreadPoolTest, ParallelReduceIsDeterministic) {
+    cppds::thread_pool pool(4);
+
+    auto reduce = [&] {
+        return pool.parallel_reduce(0, 100000, 64, 0.0,
+            [](std::size_t _begin, std::size_t _end) {
+                double partial = 0;
+                for (std::size_t i = _begin; i < _end; ++i) {
+                    partial += 1.0 / double(i + 1);
+                }
+                return partial;
+            },
+            [](double _a, double _b) { return _a + _b; });
+    };
+
+    double first = reduce();
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(reduce(), first);
+    }
+}
+
+TEST(ThreadPoolTest, ParallelInvoke) {
+    cppds::thread_pool pool(2);
+    std::atomic<int> a {0}, b {0}, c {0};
+
+    pool.parallel_invoke([&] { a = 1; }, [&] { b = 2; }, [&] { c = 3; });
+
+    EXPECT_EQ(a.load() + b.load() + c.load(), 6);
+
+    pool.parallel_invoke();
+}
+
+namespace {
+    struct total {
+        explicit total(std::uint64_t _value) : value(_value) {}
+
+        std::uint64_t value;
+    };
+}
+
+TEST(ThreadPoolTest, ParallelReduceWithoutDefaultConstructor) {
+    cppds::thread_pool pool(4);
+
+    total sum = pool.parallel_reduce(0, 1000, 10, total(0),
+        [](std::size_t _begin, std::size_t _end) {
+            return total((_begin + _end - 1) * (_end - _begin) / 2);
+        },
+        [](total _a, total _b) { return total(_a.value + _b.value); });
+
+    EXPECT_EQ(sum.value, std::uint64_t(999) * 1000 / 2);
+}
+
+TEST(ThreadPoolTest, NestedParallelism) {
+    cppds::thread_pool pool(4);
+    std::atomic<std::size_t> count {0};
+
+    pool.parallel_for(0, 64, 1, [&](std::size_t) {
+        pool.parallel_for(0, 64, 1, [&](std::size_t) {
+            pool.parallel_invoke([&] { count.fetch_add(1); }, [&] { count.fetch_add(1); });
+        });
+    });
+
+    EXPECT_EQ(count.load(), 64 * 64 * 2);
+}
+
+TEST(ThreadPoolTest, ExceptionsPropagate) {
+    cppds::thread_pool pool(4);
+    std::atomic<std::size_t> count {0};
+
+    EXPECT_THROW(pool.parallel_for(0, 1000, 1, [&](std::size_t i) {
+        count.fetch_add(1);
+        if (i == 500) {
+            throw std::runtime_error("boom");
+        }
+    }), std::runtime_error);
+
+    EXPECT_THROW(pool.parallel_invoke([] {}, [] { throw std::logic_error("boom"); }), std::logic_error);
+
+    // The pool is still usable.
+    count = 0;
+    pool.parallel_for(0, 100, 1, [&](std::size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 100);
+}
+
+TEST(ThreadPoolTest, ConcurrentExternalCallers) {
+    cppds::thread_pool pool(2);
+    std::atomic<std::size_t> count {0};
+
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; ++t) {
+        callers.emplace_back([&] {
+            for (int round = 0; round < 20; ++round) {
+                pool.parallel_for(0, 100, 3, [&](std::size_t) { count.fetch_add(1); });
+            }
+        });
+    }
+
+    for (std::thread &caller : callers) {
+        caller.join();
+    }
+
+    EXPECT_EQ(count.load(), 4 * 20 * 100);
+}
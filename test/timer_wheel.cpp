@@ -0,0 +1,198 @@
+#include <cppds/timer_wheel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+TEST(TimerWheelTest, EmptyWheel) {
+    cppds::timer_wheel wheel;
+
+    EXPECT_EQ(wheel.size(), 0);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.advance(1000), 0);
+    EXPECT_EQ(wheel.now(), 1000);
+    EXPECT_EQ(wheel.next_expiry(), UINT64_MAX);
+}
+
+TEST(TimerWheelTest, FireInOrder) {
+    cppds::timer_wheel wheel;
+    std::vector<std::uint64_t> fired;
+
+    cppds::timer a([&] { fired.push_back(wheel.now()); });
+    cppds::timer b([&] { fired.push_back(wheel.now()); });
+    cppds::timer c([&] { fired.push_back(wheel.now()); });
+
+    wheel.schedule(a, 100000);
+    wheel.schedule(b, 5);
+    wheel.schedule(c, 300);
+
+    EXPECT_EQ(wheel.size(), 3);
+    EXPECT_TRUE(b.scheduled());
+    EXPECT_EQ(b.expiry(), 5);
+
+    EXPECT_EQ(wheel.advance(4), 0);
+    EXPECT_EQ(wheel.advance(299), 1);
+    EXPECT_FALSE(b.scheduled());
+
+    EXPECT_EQ(wheel.advance(1000000), 2);
+    EXPECT_EQ(fired, (std::vector<std::uint64_t> {5, 300, 100000}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, CancelAndReschedule) {
+    cppds::timer_wheel wheel(50);
+    int count = 0;
+
+    cppds::timer a([&] { ++count; });
+    cppds::timer b([&] { ++count; });
+
+    wheel.schedule_after(a, 10);
+    wheel.schedule_after(b, 10);
+
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+
+    wheel.schedule(b, 5000);
+    EXPECT_EQ(wheel.size(), 1);
+
+    EXPECT_EQ(wheel.advance(4999), 0);
+    EXPECT_EQ(wheel.next_expiry(), 5000);
+    EXPECT_EQ(wheel.advance(5000), 1);
+    EXPECT_EQ(count, 1);
+}
+
+TEST(TimerWheelTest, PastExpiryFiresOnNextAdvance) {
+    cppds::timer_wheel wheel(100);
+    int count = 0;
+
+    cppds::timer a([&] { ++count; });
+    wheel.schedule(a, 10);
+
+    EXPECT_EQ(a.expiry(), 100);
+    EXPECT_EQ(wheel.advance(100), 1);
+    EXPECT_EQ(count, 1);
+}
+
+TEST(TimerWheelTest, DestroyedTimerIsCancelled) {
+    cppds::timer_wheel wheel;
+
+    {
+        cppds::timer a([] { FAIL(); });
+        wheel.schedule(a, 10);
+    }
+
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.advance(100), 0);
+}
+
+TEST(TimerWheelTest, CallbacksModifyWheel) {
+    cppds::timer_wheel wheel;
+    std::vector<std::uint64_t> fired;
+
+    auto victim = std::make_unique<cppds::timer>([] { FAIL(); });
+    cppds::timer periodic;
+    cppds::timer killer([&] { victim.reset(); });
+
+    periodic.set_callback([&] {
+        fired.push_back(wheel.now());
+        if (fired.size() < 3) {
+            wheel.schedule_after(periodic, 1000);
+        }
+    });
+
+    wheel.schedule(periodic, 10);
+    wheel.schedule(killer, 2010);
+    wheel.schedule(*victim, 2010);
+
+    EXPECT_EQ(wheel.advance(100000), 4);
+    EXPECT_EQ(fired, (std::vector<std::uint64_t> {10, 1010, 2010}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, WheelDestroyedBeforeTimers) {
+    cppds::timer a;
+
+    {
+        cppds::timer_wheel wheel;
+        wheel.schedule(a, 1 << 20);
+    }
+
+    EXPECT_FALSE(a.scheduled());
+}
+
+TEST(TimerWheelTest, LargeTimes) {
+    cppds::timer_wheel wheel(UINT64_MAX - 1000);
+    int count = 0;
+
+    cppds::timer a([&] { ++count; });
+    cppds::timer b([&] { ++count; });
+
+    wheel.schedule(a, UINT64_MAX);
+    wheel.schedule(b, UINT64_MAX - 500);
+
+    EXPECT_EQ(wheel.advance(UINT64_MAX - 1), 1);
+    EXPECT_EQ(wheel.advance(UINT64_MAX), 1);
+    EXPECT_EQ(count, 2);
+}
+
+TEST(TimerWheelTest, RandomScheduleMatchesReference) {
+    std::mt19937_64 rng(6);
+    cppds::timer_wheel wheel;
+
+    constexpr std::size_t count = 2000;
+    std::vector<std::uint64_t> fired_at(count, 0);
+    std::vector<std::unique_ptr<cppds::timer>> timers;
+    std::map<std::size_t, std::uint64_t> expected;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        timers.push_back(std::make_unique<cppds::timer>([&, i] { fired_at[i] = wheel.now(); }));
+    }
+
+    for (int step = 0; step < 20000; ++step) {
+        std::size_t i = rng() % count;
+
+        switch (rng() % 4) {
+        case 0:
+        case 1: {
+            // Mostly near, sometimes far in the future.
+            std::uint64_t delay = rng() % 8 == 0 ? rng() % (1 << 24) : rng() % 5000;
+            wheel.schedule(*timers[i], wheel.now() + delay);
+            expected[i] = wheel.now() + delay;
+            break;
+        }
+        case 2:
+            ASSERT_EQ(wheel.cancel(*timers[i]), expected.erase(i) == 1);
+            break;
+        case 3: {
+            std::uint64_t now = wheel.now() + rng() % 3000;
+            std::size_t due = 0;
+
+            for (auto it = expected.begin(); it != expected.end();) {
+                if (it->second <= now) {
+                    fired_at[it->first] = 0;
+                    ++due;
+                }
+                ++it;
+            }
+
+            ASSERT_EQ(wheel.advance(now), due);
+
+            for (auto it = expected.begin(); it != expected.end();) {
+                if (it->second <= now) {
+                    ASSERT_EQ(fired_at[it->first], it->second);
+                    it = expected.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            break;
+        }
+        }
+
+        ASSERT_EQ(wheel.size(), expected.size());
+    }
+}
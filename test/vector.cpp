@@ -2,6 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "alloc_tracker.hpp"
+
 TEST(VectorTest, EmptyVector) {
     cppds::vector<int> v;
 
@@ -50,4 +56,354 @@ TEST(VectorTest, Clear) {
     v.clear();
 
     EXPECT_EQ(v.size(), 0);
+}
+
+TEST(VectorTest, PushBackMove) {
+    cppds::vector<std::string> v;
+    std::string value(100, 'x');
+    const char *buffer = value.data();
+
+    v.push_back(std::move(value));
+
+    ASSERT_EQ(v.size(), 1);
+    EXPECT_EQ(v[0].data(), buffer);
+
+    for (int i = 0; i < 20; ++i) {
+        v.push_back(std::move(v[0]));
+        v[0] = std::string(100, 'y');
+    }
+
+    EXPECT_EQ(v.size(), 21);
+    EXPECT_EQ(v.back(), std::string(100, 'y'));
+    EXPECT_EQ(v[1], std::string(100, 'x'));
+}
+
+TEST(VectorTest, Insert) {
+    cppds::vector<int> v = {10, 30};
+
+    v.insert(1, 20);
+    v.push_front(0);
+
+    EXPECT_EQ(v.size(), 4);
+
+    EXPECT_EQ(v[0], 0);
+    EXPECT_EQ(v[1], 10);
+    EXPECT_EQ(v[2], 20);
+    EXPECT_EQ(v[3], 30);
+}
+
+TEST(VectorTest, ResizeValueInitializes) {
+    cppds::vector<int> v = {10};
+
+    v.resize(3);
+
+    EXPECT_EQ(v.size(), 3);
+
+    EXPECT_EQ(v[0], 10);
+    EXPECT_EQ(v[1], 0);
+    EXPECT_EQ(v[2], 0);
+
+    v.resize(5, 7);
+
+    EXPECT_EQ(v[4], 7);
+
+    v.resize(1);
+
+    EXPECT_EQ(v.size(), 1);
+    EXPECT_EQ(v[0], 10);
+}
+
+TEST(VectorTest, ResizeDefaultInit) {
+    cppds::vector<int> v = {10};
+
+    v.resize(4, cppds::default_init);
+
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v[0], 10);
+}
+
+TEST(VectorTest, ResizeUninitialized) {
+    cppds::vector<char> v;
+
+    v.resize_uninitialized(1024);
+
+    EXPECT_EQ(v.size(), 1024);
+    EXPECT_GE(v.capacity(), 1024);
+}
+
+TEST(VectorTest, AppendFrom) {
+    cppds::vector<char> v = {'a'};
+
+    size_t appended = v.append_from([](char *dest, size_t count) {
+        for (size_t i = 0; i < 3 && i < count; ++i) {
+            dest[i] = 'b' + i;
+        }
+        return size_t(3);
+    }, 8);
+
+    EXPECT_EQ(appended, 3);
+    EXPECT_EQ(v.size(), 4);
+
+    EXPECT_EQ(v[1], 'b');
+    EXPECT_EQ(v[3], 'd');
+}
+
+TEST(VectorTest, RangeConstructAndAssign) {
+    int values[] = {1, 2, 3, 4};
+
+    cppds::vector<int> v(values + 1, values + 4);
+
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v[0], 2);
+    EXPECT_EQ(v[2], 4);
+
+    v.assign(values, values + 2);
+
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[1], 2);
+
+    v.assign(v.begin() + 1, v.end());
+
+    EXPECT_EQ(v.size(), 1);
+    EXPECT_EQ(v[0], 2);
+}
+
+TEST(VectorTest, RangeAppendAndInsert) {
+    cppds::vector<std::string> v = {"a", "e"};
+    std::string middle[] = {"b", "c", "d"};
+
+    v.insert(1, middle, middle + 3);
+
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[1], "b");
+    EXPECT_EQ(v[3], "d");
+    EXPECT_EQ(v[4], "e");
+
+    v.append(v.begin(), v.begin() + 2);
+
+    EXPECT_EQ(v.size(), 7);
+    EXPECT_EQ(v[5], "a");
+    EXPECT_EQ(v[6], "b");
+
+    cppds::vector<std::string> w = std::move(v);
+
+    EXPECT_EQ(w.size(), 7);
+    EXPECT_EQ(v.size(), 0);
+}
+
+TEST(VectorTest, EraseRange) {
+    cppds::vector<int> v = {0, 1, 2, 3, 4};
+
+    v.erase(1, 3);
+
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v[0], 0);
+    EXPECT_EQ(v[1], 3);
+    EXPECT_EQ(v[2], 4);
+}
+
+TEST(VectorTest, EraseIf) {
+    cppds::vector<int> v;
+
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+
+    EXPECT_EQ(v.erase_if([](int x) { return x % 3 == 0; }), 34);
+    EXPECT_EQ(v.size(), 66);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[1], 2);
+    EXPECT_EQ(v[2], 4);
+
+    EXPECT_EQ(v.retain(cppds::less_than(50)), 33);
+    EXPECT_EQ(v.size(), 33);
+    EXPECT_EQ(v.back(), 49);
+
+    cppds::vector<std::string> s = {"a", "bb", "c", "dd"};
+
+    s.retain([](const std::string &x) { return x.size() == 2; });
+
+    EXPECT_EQ(s.size(), 2);
+    EXPECT_EQ(s[0], "bb");
+    EXPECT_EQ(s[1], "dd");
+}
+
+TEST(VectorTest, EraseIfCompare) {
+    cppds::vector<float> v;
+    cppds::vector<unsigned> u;
+
+    for (int i = 0; i < 37; ++i) {
+        v.push_back(i * 0.5f);
+        u.push_back(i * 1000000000u);
+    }
+
+    EXPECT_EQ(v.erase_if(cppds::greater_equal(10.0f)), 17);
+    EXPECT_EQ(v.size(), 20);
+
+    for (size_t i = 0; i < v.size(); ++i) {
+        EXPECT_EQ(v[i], i * 0.5f);
+    }
+
+    u.erase_if(cppds::greater_than(3000000000u));
+
+    for (size_t i = 0; i < u.size(); ++i) {
+        EXPECT_LE(u[i], 3000000000u);
+    }
+}
+
+TEST(VectorTest, RetainCompareDropsNaN) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    cppds::vector<float> v;
+    cppds::vector<float> expected;
+
+    for (int i = 0; i < 37; ++i) {
+        v.push_back(i % 3 == 0 ? nan : i * 0.1f);
+    }
+
+    expected = v;
+    expected.retain([](float x) { return x < 0.5f; });
+
+    EXPECT_EQ(v.retain(cppds::less_than(0.5f)), 37 - expected.size());
+    ASSERT_EQ(v.size(), expected.size());
+
+    for (size_t i = 0; i < v.size(); ++i) {
+        EXPECT_FALSE(std::isnan(v[i]));
+        EXPECT_EQ(v[i], expected[i]);
+    }
+}
+
+TEST(VectorTest, SwapRemove) {
+    cppds::vector<int> v = {10, 20, 30};
+
+    v.swap_remove(0);
+
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0], 30);
+    EXPECT_EQ(v[1], 20);
+}
+
+TEST(VectorTest, AlignedStorage) {
+    cppds::aligned_vector<float> v;
+
+    for (int i = 0; i < 37; ++i) {
+        v.push_back(float(i));
+
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % 64, 0);
+        EXPECT_GE(v.capacity(), v.padded_size());
+    }
+
+    EXPECT_EQ(v.padded_size(), 48);
+    EXPECT_EQ(v[36], 36.0f);
+
+    cppds::aligned_vector<float> w = v;
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(w.data()) % 64, 0);
+    EXPECT_EQ(w.size(), 37);
+    EXPECT_EQ(w[36], 36.0f);
+}
+
+TEST(VectorTest, NoAllocationsAfterReserve) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    cppds::vector<int> v;
+
+    cppds_test::alloc_tracker reserve;
+    v.reserve(1000);
+    EXPECT_EQ(reserve.allocations(), 1);
+    EXPECT_GE(reserve.bytes(), 1000 * sizeof(int));
+
+    cppds_test::alloc_tracker tracker;
+
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+
+    long sum = 0;
+    for (size_t i = 0; i < v.size(); ++i) {
+        sum += v.at(i);
+    }
+
+    v.erase_if(cppds::greater_than(500));
+    v.swap_remove(0);
+    v.erase(0, 10);
+    v.resize(1000);
+    v.pop_back();
+
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(tracker.frees(), 0);
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+TEST(VectorTest, RangeAssignAllocatesOnce) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    int values[4096];
+    for (int i = 0; i < 4096; ++i) {
+        values[i] = i;
+    }
+
+    cppds::vector<int> v;
+
+    cppds_test::alloc_tracker tracker;
+    v.assign(values, values + 4096);
+    v.append(values, values + 10);
+    EXPECT_EQ(tracker.allocations(), 2);
+
+    tracker.reset();
+    cppds::vector<int> copy = v;
+    EXPECT_EQ(tracker.allocations(), 1);
+}
+
+TEST(VectorTest, ClearKeepsCapacity) {
+    cppds::vector<int> v = {10, 20, 30};
+
+    size_t capacity = v.capacity();
+
+    v.clear();
+
+    EXPECT_EQ(v.size(), 0);
+    EXPECT_EQ(v.capacity(), capacity);
+
+    v.push_back(40);
+    v.shrink_to_fit();
+
+    EXPECT_EQ(v.capacity(), 1);
+    EXPECT_EQ(v[0], 40);
+
+    v.release();
+
+    EXPECT_EQ(v.size(), 0);
+    EXPECT_EQ(v.capacity(), 0);
+    EXPECT_EQ(v.data(), nullptr);
+}
+
+TEST(VectorTest, NoAllocationsOnClearAndReuse) {
+    if (!cppds_test::alloc_tracker::supported()) {
+        GTEST_SKIP() << "allocation tracking unavailable";
+    }
+
+    cppds::vector<std::string> v;
+
+    for (int i = 0; i < 100; ++i) {
+        v.push_back("a string long enough to be heap allocated");
+    }
+
+    v.clear();
+
+    cppds_test::alloc_tracker tracker;
+
+    for (int batch = 0; batch < 10; ++batch) {
+        for (int i = 0; i < 100; ++i) {
+            v.resize(v.size() + 1);
+        }
+        v.clear();
+    }
+
+    EXPECT_EQ(tracker.allocations(), 0);
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <cppds/work_stealing_deque.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(WorkStealingDequeTest, EmptyDeque) {
+    cppds::work_stealing_deque<int> d;
+    int value = 0;
+
+    EXPECT_EQ(d.size(), 0);
+    EXPECT_TRUE(d.empty());
+
+    EXPECT_FALSE(d.pop(value));
+    EXPECT_FALSE(d.steal(value));
+    EXPECT_TRUE(d.empty());
+}
+
+TEST(WorkStealingDequeTest, OwnerPopsLifoThievesStealFifo) {
+    cppds::work_stealing_deque<int> d;
+    int value = 0;
+
+    d.push(1);
+    d.push(2);
+    d.push(3);
+
+    EXPECT_EQ(d.size(), 3);
+
+    EXPECT_TRUE(d.pop(value));
+    EXPECT_EQ(value, 3);
+
+    EXPECT_TRUE(d.steal(value));
+    EXPECT_EQ(value, 1);
+
+    EXPECT_TRUE(d.pop(value));
+    EXPECT_EQ(value, 2);
+
+    EXPECT_FALSE(d.pop(value));
+    EXPECT_FALSE(d.steal(value));
+}
+
+TEST(WorkStealingDequeTest, Grow) {
+    cppds::work_stealing_deque<int> d(4);
+    int value = 0;
+
+    EXPECT_EQ(d.capacity(), 4);
+
+    d.push(0);
+    d.push(1);
+    EXPECT_TRUE(d.steal(value));
+    EXPECT_TRUE(d.steal(value));
+
+    // Wrap around the ring before growing.
+    for (int i = 0; i < 100; ++i) {
+        d.push(i);
+    }
+
+    EXPECT_EQ(d.size(), 100);
+    EXPECT_GE(d.capacity(), 100);
+
+    EXPECT_TRUE(d.steal(value));
+    EXPECT_EQ(value, 0);
+
+    for (int i = 99; i > 0; --i) {
+        ASSERT_TRUE(d.pop(value));
+        ASSERT_EQ(value, i);
+    }
+
+    EXPECT_TRUE(d.empty());
+}
+
+TEST(WorkStealingDequeTest, ConcurrentStealsTakeEachElementOnce) {
+    constexpr int count = 100000;
+    constexpr int thieves = 3;
+
+    cppds::work_stealing_deque<int> d(16);
+    std::vector<std::atomic<int>> taken(count);
+    std::atomic<int> remaining {count};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (remaining.load() > 0) {
+                if (d.steal(value)) {
+                    taken[value].fetch_add(1);
+                    remaining.fetch_sub(1);
+                }
+            }
+        });
+    }
+
+    int value = 0;
+    for (int i = 0; i < count; ++i) {
+        d.push(i);
+
+        // Pop every third element back, racing the thieves for the last one.
+        if (i % 3 == 0 && d.pop(value)) {
+            taken[value].fetch_add(1);
+            remaining.fetch_sub(1);
+        }
+    }
+
+    while (d.pop(value)) {
+        taken[value].fetch_add(1);
+        remaining.fetch_sub(1);
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(remaining.load(), 0);
+
+    for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << i;
+    }
+}
+
+TEST(WorkStealingDequeTest, StolenPointersPublishTheirTargets) {
+    constexpr int count = 20000;
+
+    struct task {
+        std::uint64_t payload;
+    };
+
+    cppds::work_stealing_deque<task *> d(2);
+    std::vector<task> tasks(count);
+    std::atomic<int> remaining {count};
+    std::atomic<std::uint64_t> sum {0};
+
+    std::thread thief([&] {
+        task *t = nullptr;
+        while (remaining.load() > 0) {
+            if (d.steal(t)) {
+                sum.fetch_add(t->payload);
+                remaining.fetch_sub(1);
+            }
+        }
+    });
+
+    for (int i = 0; i < count; ++i) {
+        tasks[i].payload = std::uint64_t(i);
+        d.push(&tasks[i]);
+    }
+
+    task *t = nullptr;
+    while (d.pop(t)) {
+        sum.fetch_add(t->payload);
+        remaining.fetch_sub(1);
+    }
+
+    thief.join();
+
+    EXPECT_EQ(sum.load(), std::uint64_t(count) * (count - 1) / 2);
+}